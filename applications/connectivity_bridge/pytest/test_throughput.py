@@ -0,0 +1,79 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+import logging
+import os
+import time
+
+import serial
+from serial.tools import list_ports
+from twister_harness import DeviceAdapter
+
+logger = logging.getLogger(__name__)
+
+NORDIC_VID = 0x1915
+BAUDRATE = 1000000
+DURATION_S = 60
+CHUNK_SIZE = 4096
+READ_TIMEOUT_S = 5.0
+
+
+def find_bridge_port(dut: DeviceAdapter) -> str:
+    """Return the first CDC ACM port exposed by the bridge under test."""
+    serial_number = dut.device_config.id
+    ports = sorted(
+        (
+            p
+            for p in list_ports.comports()
+            if p.vid == NORDIC_VID and (not serial_number or p.serial_number == serial_number)
+        ),
+        key=lambda p: p.device,
+    )
+    assert ports, f"No connectivity bridge CDC ACM port found for {serial_number}"
+
+    return ports[0].device
+
+
+def test_throughput(dut: DeviceAdapter):
+    """
+    Stream random data through the bridge at 1 Mbaud for a sustained period.
+    The UART side is looped back by the fixture, so every byte sent to the
+    CDC ACM port is received back. Check that no data is lost or reordered
+    even though the host writes faster than the loop can drain.
+    """
+    port = find_bridge_port(dut)
+    logger.info(f"Using {port} at {BAUDRATE} baud")
+
+    with serial.Serial(port, BAUDRATE, rtscts=True, timeout=0) as ser:
+        ser.reset_input_buffer()
+
+        sent = bytearray()
+        received = bytearray()
+        start = time.monotonic()
+
+        while time.monotonic() - start < DURATION_S:
+            chunk = os.urandom(CHUNK_SIZE)
+            ser.write(chunk)
+            sent += chunk
+            received += ser.read(ser.in_waiting or 1)
+
+        last_rx = time.monotonic()
+        while len(received) < len(sent) and time.monotonic() - last_rx < READ_TIMEOUT_S:
+            data = ser.read(ser.in_waiting or 1)
+            if data:
+                received += data
+                last_rx = time.monotonic()
+
+        elapsed = time.monotonic() - start
+
+    logger.info(
+        f"Sent {len(sent)} B, received {len(received)} B in {elapsed:.1f} s "
+        f"({len(received) * 8 / elapsed / 1000:.0f} kbit/s)"
+    )
+
+    assert len(received) == len(sent), f"Lost {len(sent) - len(received)} bytes"
+    mismatch = next((i for i, (a, b) in enumerate(zip(sent, received)) if a != b), None)
+    assert mismatch is None, f"Data mismatch at offset {mismatch}"
@@ -34,6 +34,26 @@ struct cdc_data_event {
 
 APP_EVENT_TYPE_DECLARE(cdc_data_event);
 
+/**
+ * @brief Keep the data of a CDC data event valid after the event is processed.
+ *
+ * A listener that cannot consume the data right away holds it instead of dropping it.
+ * When all buffers of an instance are held, reception from the USB host is paused
+ * until the data is released, and the host is NAKed.
+ *
+ * @param buf Pointer to the data of the event.
+ */
+void cdc_data_hold(const uint8_t *buf);
+
+/**
+ * @brief Release data held with @ref cdc_data_hold.
+ *
+ * This function can be called from an interrupt context.
+ *
+ * @param buf Pointer to the data passed to @ref cdc_data_hold.
+ */
+void cdc_data_release(const uint8_t *buf);
+
 #ifdef __cplusplus
 }
 #endif
@@ -34,6 +34,26 @@ struct uart_data_event {
 
 APP_EVENT_TYPE_DECLARE(uart_data_event);
 
+/**
+ * @brief Keep the data of a UART data event valid after the event is processed.
+ *
+ * A listener that cannot consume the data right away holds it instead of dropping it.
+ * When all buffers of an instance are held, UART reception is paused until the data
+ * is released. RTS is deasserted meanwhile if hardware flow control is used.
+ *
+ * @param buf Pointer to the data of the event.
+ */
+void uart_data_hold(const uint8_t *buf);
+
+/**
+ * @brief Release data held with @ref uart_data_hold.
+ *
+ * This function can be called from an interrupt context.
+ *
+ * @param buf Pointer to the data passed to @ref uart_data_hold.
+ */
+void uart_data_release(const uint8_t *buf);
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,20 +39,38 @@ static const struct device *devices[] = {
 #define UART_SET_PM_STATE false
 #endif
 
+#if defined(CONFIG_BRIDGE_CDC_ENABLE)
+#define UART_TX_PENDING_COUNT CONFIG_BRIDGE_CDC_BUF_COUNT
+#else
+#define UART_TX_PENDING_COUNT 1
+#endif
+
 struct uart_rx_buf {
 	atomic_t ref_counter;
-	size_t len;
+	uint8_t dev_idx;
 	uint8_t buf[UART_BUF_SIZE];
 };
 
+/* CDC data that did not fit in the TX ring buffer, held until there is space */
+struct uart_tx_pending {
+	const uint8_t *held;
+	const uint8_t *buf;
+	size_t len;
+};
+
 struct uart_tx_buf {
 	struct ring_buf rb;
 	uint8_t buf[UART_BUF_SIZE];
+	struct uart_tx_pending pending[UART_TX_PENDING_COUNT];
+	uint8_t pending_head;
+	uint8_t pending_count;
+	struct k_spinlock lock;
 };
 
 BUILD_ASSERT((sizeof(struct uart_rx_buf) % UART_SLAB_ALIGNMENT) == 0);
 
-/* Blocks from the same slab is used for RX for all UART instances */
+/* Blocks from the same slab is used for RX for all UART instances, */
+/* but each instance can only hold CONFIG_BRIDGE_UART_BUF_COUNT blocks at a time. */
 /* TX has inidividual ringbuffers per UART instance */
 
 K_MEM_SLAB_DEFINE(uart_rx_slab, UART_SLAB_BLOCK_SIZE, UART_SLAB_BLOCK_COUNT, UART_SLAB_ALIGNMENT);
@@ -63,12 +81,22 @@ static uint32_t uart_default_baudrate[UART_DEVICE_COUNT];
 static int subscriber_count[UART_DEVICE_COUNT];
 static bool enable_rx_retry[UART_DEVICE_COUNT];
 static atomic_t uart_tx_started[UART_DEVICE_COUNT];
+static atomic_t uart_rx_block_count[UART_DEVICE_COUNT];
+/* RX buffer request could not be served because all blocks are held by the receivers */
+static ATOMIC_DEFINE(uart_rx_starved, UART_DEVICE_COUNT);
+/* RX was disabled by the driver while starved, and has to be enabled again */
+static ATOMIC_DEFINE(uart_rx_stopped, UART_DEVICE_COUNT);
+
+static void uart_rx_resume_work_handler(struct k_work *work);
 
-static void enable_uart_rx(uint8_t dev_idx);
+static K_WORK_DEFINE(uart_rx_resume_work, uart_rx_resume_work_handler);
+
+static int enable_uart_rx(uint8_t dev_idx);
 static void disable_uart_rx(uint8_t dev_idx);
 static void set_uart_power_state(uint8_t dev_idx, bool active);
 static int uart_tx_start(uint8_t dev_idx);
 static void uart_tx_finish(uint8_t dev_idx, size_t len);
+static void uart_tx_pending_flush(uint8_t dev_idx);
 
 static inline struct uart_rx_buf *block_start_get(uint8_t *buf)
 {
@@ -83,7 +111,7 @@ static inline struct uart_rx_buf *block_start_get(uint8_t *buf)
 	return (struct uart_rx_buf *) &uart_rx_slab.buffer[block_num * UART_SLAB_BLOCK_SIZE];
 }
 
-static struct uart_rx_buf *uart_rx_buf_alloc(void)
+static struct uart_rx_buf *uart_rx_buf_alloc(uint8_t dev_idx)
 {
 	struct uart_rx_buf *buf;
 	int err;
@@ -93,16 +121,35 @@ static struct uart_rx_buf *uart_rx_buf_alloc(void)
 	/* This code uses a reference counter to keep track of the number of */
 	/* references within a single RX buffer block */
 
+	if (atomic_inc(&uart_rx_block_count[dev_idx]) >= CONFIG_BRIDGE_UART_BUF_COUNT) {
+		atomic_dec(&uart_rx_block_count[dev_idx]);
+		return NULL;
+	}
+
 	err = k_mem_slab_alloc(&uart_rx_slab, (void **) &buf, K_NO_WAIT);
 	if (err) {
+		atomic_dec(&uart_rx_block_count[dev_idx]);
 		return NULL;
 	}
 
 	atomic_set(&buf->ref_counter, 1);
+	buf->dev_idx = dev_idx;
 
 	return buf;
 }
 
+static void uart_rx_buf_free(struct uart_rx_buf *buf, bool resume)
+{
+	uint8_t dev_idx = buf->dev_idx;
+
+	k_mem_slab_free(&uart_rx_slab, (void *)buf);
+	atomic_dec(&uart_rx_block_count[dev_idx]);
+
+	if (resume && atomic_test_bit(uart_rx_starved, dev_idx)) {
+		k_work_submit(&uart_rx_resume_work);
+	}
+}
+
 static void uart_rx_buf_ref(void *buf)
 {
 	__ASSERT_NO_MSG(buf);
@@ -119,7 +166,56 @@ static void uart_rx_buf_unref(void *buf)
 
 	/* ref_counter is the uart_buf->ref_counter value prior to decrement */
 	if (ref_counter == 1) {
-		k_mem_slab_free(&uart_rx_slab, (void *)uart_buf);
+		uart_rx_buf_free(uart_buf, true);
+	}
+}
+
+void uart_data_hold(const uint8_t *buf)
+{
+	uart_rx_buf_ref((void *)buf);
+}
+
+void uart_data_release(const uint8_t *buf)
+{
+	uart_rx_buf_unref((void *)buf);
+}
+
+static void uart_rx_resume(uint8_t dev_idx)
+{
+	struct uart_rx_buf *buf;
+	int err;
+
+	if (atomic_test_and_clear_bit(uart_rx_stopped, dev_idx)) {
+		if (subscriber_count[dev_idx] == 0) {
+			atomic_clear_bit(uart_rx_starved, dev_idx);
+		} else if (enable_uart_rx(dev_idx) == 0) {
+			LOG_DBG("UART_%d RX resumed", dev_idx);
+		}
+		return;
+	}
+
+	/* Reception is still ongoing, provide the buffer that was requested */
+	buf = uart_rx_buf_alloc(dev_idx);
+	if (buf == NULL) {
+		return;
+	}
+
+	err = uart_rx_buf_rsp(devices[dev_idx], buf->buf, sizeof(buf->buf));
+	if (err) {
+		/* Too late, RX is resumed on UART_RX_DISABLED */
+		uart_rx_buf_free(buf, false);
+		return;
+	}
+
+	atomic_clear_bit(uart_rx_starved, dev_idx);
+}
+
+static void uart_rx_resume_work_handler(struct k_work *work)
+{
+	for (int i = 0; i < UART_DEVICE_COUNT; ++i) {
+		if (atomic_test_bit(uart_rx_starved, i)) {
+			uart_rx_resume(i);
+		}
 	}
 }
 
@@ -147,9 +243,12 @@ static void uart_callback(const struct device *dev, struct uart_event *evt,
 		}
 		break;
 	case UART_RX_BUF_REQUEST:
-		buf = uart_rx_buf_alloc();
+		buf = uart_rx_buf_alloc(dev_idx);
 		if (buf == NULL) {
-			LOG_WRN("UART_%d RX overflow", dev_idx);
+			/* All buffers are held by the receivers. Reception stops when the */
+			/* current buffer is full, which deasserts RTS if flow control is used. */
+			LOG_DBG("UART_%d RX paused", dev_idx);
+			atomic_set_bit(uart_rx_starved, dev_idx);
 			break;
 		}
 
@@ -163,12 +262,17 @@ static void uart_callback(const struct device *dev, struct uart_event *evt,
 		if (enable_rx_retry[dev_idx]) {
 			enable_uart_rx(dev_idx);
 			enable_rx_retry[dev_idx] = false;
+		} else if (atomic_test_bit(uart_rx_starved, dev_idx) &&
+			   subscriber_count[dev_idx] > 0) {
+			atomic_set_bit(uart_rx_stopped, dev_idx);
+			uart_rx_resume(dev_idx);
 		} else if (UART_SET_PM_STATE) {
 			set_uart_power_state(dev_idx, false);
 		}
 		break;
 	case UART_TX_DONE:
 		uart_tx_finish(dev_idx, evt->data.tx.len);
+		uart_tx_pending_flush(dev_idx);
 
 		if (ring_buf_is_empty(&uart_tx_ringbufs[dev_idx].rb)) {
 			atomic_set(&uart_tx_started[dev_idx], false);
@@ -235,7 +339,7 @@ static void set_uart_power_state(uint8_t dev_idx, bool active)
 #endif
 }
 
-static void enable_uart_rx(uint8_t dev_idx)
+static int enable_uart_rx(uint8_t dev_idx)
 {
 	const struct device *dev = devices[dev_idx];
 	int err;
@@ -244,21 +348,28 @@ static void enable_uart_rx(uint8_t dev_idx)
 	err = uart_callback_set(dev, uart_callback, (void *) (int) dev_idx);
 	if (err) {
 		LOG_ERR("uart_callback_set: %d", err);
-		return;
+		return err;
 	}
 
-	buf = uart_rx_buf_alloc();
+	buf = uart_rx_buf_alloc(dev_idx);
 	if (!buf) {
-		LOG_ERR("uart_rx_buf_alloc error");
-		return;
+		/* RX is enabled once the receivers release a buffer */
+		LOG_DBG("UART_%d RX paused", dev_idx);
+		atomic_set_bit(uart_rx_starved, dev_idx);
+		atomic_set_bit(uart_rx_stopped, dev_idx);
+		return -ENOMEM;
 	}
 
+	atomic_clear_bit(uart_rx_starved, dev_idx);
+
 	err = uart_rx_enable(dev, buf->buf, sizeof(buf->buf), UART_RX_TIMEOUT_USEC);
 	if (err) {
-		uart_rx_buf_unref(buf);
+		uart_rx_buf_free(buf, false);
 		LOG_ERR("uart_rx_enable: %d", err);
-		return;
+		return err;
 	}
+
+	return 0;
 }
 
 static void disable_uart_rx(uint8_t dev_idx)
@@ -304,15 +415,62 @@ static void uart_tx_finish(uint8_t dev_idx, size_t len)
 	}
 }
 
-static int uart_tx_enqueue(uint8_t *data, size_t data_len, uint8_t dev_idx)
+/* Moves the held CDC data to the TX ring buffer as space becomes available */
+static void uart_tx_pending_flush(uint8_t dev_idx)
+{
+	struct uart_tx_buf *tx = &uart_tx_ringbufs[dev_idx];
+
+	if (!IS_ENABLED(CONFIG_BRIDGE_CDC_ENABLE)) {
+		return;
+	}
+
+	K_SPINLOCK(&tx->lock) {
+		while (tx->pending_count > 0) {
+			struct uart_tx_pending *pending = &tx->pending[tx->pending_head];
+			uint32_t written = ring_buf_put(&tx->rb, pending->buf, pending->len);
+
+			pending->buf += written;
+			pending->len -= written;
+			if (pending->len > 0) {
+				break;
+			}
+
+			cdc_data_release(pending->held);
+			tx->pending_head = (tx->pending_head + 1) % ARRAY_SIZE(tx->pending);
+			tx->pending_count--;
+		}
+	}
+}
+
+static int uart_tx_enqueue(const uint8_t *data, size_t data_len, uint8_t dev_idx, bool hold)
 {
+	struct uart_tx_buf *tx = &uart_tx_ringbufs[dev_idx];
 	atomic_t started;
-	uint32_t written;
+	uint32_t written = 0;
 	int err;
 
-	written = ring_buf_put(&uart_tx_ringbufs[dev_idx].rb, data, data_len);
-	if (written == 0) {
-		return -ENOMEM;
+	K_SPINLOCK(&tx->lock) {
+		/* Held data must be sent first to keep the order */
+		if (!hold || tx->pending_count == 0) {
+			written = ring_buf_put(&tx->rb, data, data_len);
+		}
+
+		if (IS_ENABLED(CONFIG_BRIDGE_CDC_ENABLE) && hold && written < data_len &&
+		    tx->pending_count < ARRAY_SIZE(tx->pending)) {
+			struct uart_tx_pending *pending = &tx->pending[
+				(tx->pending_head + tx->pending_count) % ARRAY_SIZE(tx->pending)];
+
+			cdc_data_hold(data);
+			pending->held = data;
+			pending->buf = data + written;
+			pending->len = data_len - written;
+			tx->pending_count++;
+			written = data_len;
+		}
+	}
+
+	if (ring_buf_is_empty(&tx->rb)) {
+		return written == data_len ? 0 : -ENOMEM;
 	}
 
 	started = atomic_set(&uart_tx_started[dev_idx], true);
@@ -359,7 +517,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			return false;
 		}
 
-		err = uart_tx_enqueue(event->buf, event->len, event->dev_idx);
+		err = uart_tx_enqueue(event->buf, event->len, event->dev_idx, true);
 		if (err == -ENOMEM) {
 			LOG_WRN("CDC_%d->UART_%d overflow",
 				event->dev_idx,
@@ -381,7 +539,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			return false;
 		}
 
-		err = uart_tx_enqueue(event->buf, event->len, dev_idx);
+		err = uart_tx_enqueue(event->buf, event->len, dev_idx, false);
 		if (err == -ENOMEM) {
 			LOG_WRN("BLE->UART_%d overflow", dev_idx);
 		} else if (err) {
@@ -459,6 +617,16 @@ static bool app_event_handler(const struct app_event_header *aeh)
 					return false;
 				}
 				uart_default_baudrate[i] = cfg.baudrate;
+
+				if (IS_ENABLED(CONFIG_BRIDGE_UART_HW_FLOW_CONTROL) &&
+				    cfg.flow_ctrl != UART_CFG_FLOW_CTRL_RTS_CTS) {
+					cfg.flow_ctrl = UART_CFG_FLOW_CTRL_RTS_CTS;
+
+					err = uart_configure(devices[i], &cfg);
+					if (err) {
+						LOG_ERR("uart_configure: %d", err);
+					}
+				}
 				subscriber_count[i] = 0;
 				enable_rx_retry[i] = false;
 
@@ -26,25 +26,132 @@ static const struct device *devices[] = {
 
 #define USB_CDC_DTR_POLL_MS 500
 #define USB_CDC_RX_BLOCK_SIZE CONFIG_BRIDGE_BUF_SIZE
-#define USB_CDC_RX_BLOCK_COUNT (CDC_DEVICE_COUNT * 3)
+#define USB_CDC_RX_BLOCK_COUNT (CDC_DEVICE_COUNT * CONFIG_BRIDGE_CDC_BUF_COUNT)
+#define USB_CDC_SLAB_BLOCK_SIZE sizeof(struct cdc_rx_buf)
 #define USB_CDC_SLAB_ALIGNMENT 4
+/* Contiguous UART data is merged, so there is at most one entry per UART RX buffer */
+#define USB_CDC_TX_QUEUE_SIZE CONFIG_BRIDGE_UART_BUF_COUNT
+
+struct cdc_rx_buf {
+	atomic_t ref_counter;
+	uint8_t dev_idx;
+	uint8_t buf[USB_CDC_RX_BLOCK_SIZE];
+};
+
+BUILD_ASSERT((sizeof(struct cdc_rx_buf) % USB_CDC_SLAB_ALIGNMENT) == 0);
+
+/* UART data held until the CDC ACM driver accepts it */
+struct cdc_tx_chunk {
+	const uint8_t *held;
+	const uint8_t *buf;
+	size_t len;
+};
+
+struct cdc_tx_queue {
+	struct cdc_tx_chunk chunks[USB_CDC_TX_QUEUE_SIZE];
+	uint8_t head;
+	uint8_t count;
+	struct k_spinlock lock;
+};
 
 static void cdc_dtr_timer_handler(struct k_timer *timer);
 static void cdc_dtr_work_handler(struct k_work *work);
+static void cdc_rx_resume_work_handler(struct k_work *work);
 
 static K_TIMER_DEFINE(cdc_dtr_timer, cdc_dtr_timer_handler, NULL);
 static K_WORK_DEFINE(cdc_dtr_work, cdc_dtr_work_handler);
-/* Incoming data from any CDC instance is copied into a block from this slab */
-K_MEM_SLAB_DEFINE(cdc_rx_slab, USB_CDC_RX_BLOCK_SIZE, USB_CDC_RX_BLOCK_COUNT, USB_CDC_SLAB_ALIGNMENT);
+static K_WORK_DEFINE(cdc_rx_resume_work, cdc_rx_resume_work_handler);
+/* Incoming data from any CDC instance is copied into a block from this slab, */
+/* but each instance can only hold CONFIG_BRIDGE_CDC_BUF_COUNT blocks at a time. */
+K_MEM_SLAB_DEFINE(cdc_rx_slab, USB_CDC_SLAB_BLOCK_SIZE, USB_CDC_RX_BLOCK_COUNT,
+		  USB_CDC_SLAB_ALIGNMENT);
 
 static uint32_t cdc_ready[CDC_DEVICE_COUNT];
 static uint32_t cdc_baudrate[CDC_DEVICE_COUNT];
-
-static uint8_t overflow_buf[64];
+static atomic_t cdc_rx_block_count[CDC_DEVICE_COUNT];
+/* RX interrupt disabled because all blocks are held, so the USB host is NAKed */
+static ATOMIC_DEFINE(cdc_rx_paused, CDC_DEVICE_COUNT);
+static struct cdc_tx_queue cdc_tx_queues[CDC_DEVICE_COUNT];
 
 static bool fs_module_ready;
 static bool bulk_module_ready;
 
+static void cdc_tx_queue_flush(int dev_idx);
+
+static struct cdc_rx_buf *cdc_rx_buf_alloc(int dev_idx)
+{
+	struct cdc_rx_buf *buf;
+	int err;
+
+	if (atomic_inc(&cdc_rx_block_count[dev_idx]) >= CONFIG_BRIDGE_CDC_BUF_COUNT) {
+		atomic_dec(&cdc_rx_block_count[dev_idx]);
+		return NULL;
+	}
+
+	err = k_mem_slab_alloc(&cdc_rx_slab, (void **)&buf, K_NO_WAIT);
+	if (err) {
+		atomic_dec(&cdc_rx_block_count[dev_idx]);
+		return NULL;
+	}
+
+	atomic_set(&buf->ref_counter, 1);
+	buf->dev_idx = dev_idx;
+
+	return buf;
+}
+
+static void cdc_rx_buf_free(struct cdc_rx_buf *buf)
+{
+	uint8_t dev_idx = buf->dev_idx;
+
+	k_mem_slab_free(&cdc_rx_slab, (void *)buf);
+	atomic_dec(&cdc_rx_block_count[dev_idx]);
+
+	if (atomic_test_bit(cdc_rx_paused, dev_idx)) {
+		k_work_submit(&cdc_rx_resume_work);
+	}
+}
+
+static inline struct cdc_rx_buf *cdc_block_start_get(const uint8_t *buf)
+{
+	size_t block_num;
+
+	/* Held data may point anywhere within the block */
+	block_num = ((size_t)buf - (size_t)cdc_rx_slab.buffer) / USB_CDC_SLAB_BLOCK_SIZE;
+
+	return (struct cdc_rx_buf *)&cdc_rx_slab.buffer[block_num * USB_CDC_SLAB_BLOCK_SIZE];
+}
+
+void cdc_data_hold(const uint8_t *buf)
+{
+	__ASSERT_NO_MSG(buf);
+
+	atomic_inc(&cdc_block_start_get(buf)->ref_counter);
+}
+
+void cdc_data_release(const uint8_t *buf)
+{
+	__ASSERT_NO_MSG(buf);
+
+	struct cdc_rx_buf *cdc_buf = cdc_block_start_get(buf);
+
+	/* atomic_dec returns the value prior to decrement */
+	if (atomic_dec(&cdc_buf->ref_counter) == 1) {
+		cdc_rx_buf_free(cdc_buf);
+	}
+}
+
+static void cdc_rx_resume_work_handler(struct k_work *work)
+{
+	for (int i = 0; i < CDC_DEVICE_COUNT; ++i) {
+		if (atomic_test_and_clear_bit(cdc_rx_paused, i)) {
+			/* The interrupt fires again if the driver has data buffered */
+			LOG_DBG("CDC_%d RX resumed", i);
+			uart_irq_rx_enable(devices[i]);
+		}
+	}
+}
+
 static void cdc_dtr_timer_handler(struct k_timer *timer)
 {
 	k_work_submit(&cdc_dtr_work);
@@ -86,6 +193,11 @@ static void poll_dtr(void)
 
 			cdc_ready[i] = cdc_val;
 			cdc_baudrate[i] = baudrate;
+
+			if (cdc_val == 0) {
+				/* Nobody is reading, release the held UART data */
+				cdc_tx_queue_flush(i);
+			}
 		}
 	}
 }
@@ -95,48 +207,126 @@ static void cdc_dtr_work_handler(struct k_work *work)
 	poll_dtr();
 }
 
+static void cdc_tx_queue_flush(int dev_idx)
+{
+	struct cdc_tx_queue *queue = &cdc_tx_queues[dev_idx];
+
+	K_SPINLOCK(&queue->lock) {
+		while (queue->count > 0) {
+			uart_data_release(queue->chunks[queue->head].held);
+			queue->head = (queue->head + 1) % ARRAY_SIZE(queue->chunks);
+			queue->count--;
+		}
+	}
+}
+
+static int cdc_tx_enqueue(int dev_idx, const uint8_t *buf, size_t len)
+{
+	struct cdc_tx_queue *queue = &cdc_tx_queues[dev_idx];
+	struct cdc_tx_chunk *last;
+	int err = 0;
+
+	K_SPINLOCK(&queue->lock) {
+		last = &queue->chunks[(queue->head + queue->count + ARRAY_SIZE(queue->chunks) - 1) %
+				      ARRAY_SIZE(queue->chunks)];
+
+		if (queue->count > 0 && last->buf + last->len == buf) {
+			/* Continuation of the same UART RX buffer, already held */
+			last->len += len;
+		} else if (queue->count < ARRAY_SIZE(queue->chunks)) {
+			last = &queue->chunks[(queue->head + queue->count) %
+					      ARRAY_SIZE(queue->chunks)];
+			uart_data_hold(buf);
+			last->held = buf;
+			last->buf = buf;
+			last->len = len;
+			queue->count++;
+		} else {
+			err = -ENOMEM;
+		}
+	}
+
+	return err;
+}
+
+/* Feeds the held UART data to the CDC ACM driver as it accepts more */
+static void cdc_tx_process(const struct device *dev, int dev_idx)
+{
+	struct cdc_tx_queue *queue = &cdc_tx_queues[dev_idx];
+
+	K_SPINLOCK(&queue->lock) {
+		while (queue->count > 0) {
+			struct cdc_tx_chunk *chunk = &queue->chunks[queue->head];
+			int written = uart_fifo_fill(dev, chunk->buf, chunk->len);
+
+			if (written > 0) {
+				chunk->buf += written;
+				chunk->len -= written;
+			}
+			if (chunk->len > 0) {
+				break;
+			}
+
+			uart_data_release(chunk->held);
+			queue->head = (queue->head + 1) % ARRAY_SIZE(queue->chunks);
+			queue->count--;
+		}
+
+		if (queue->count == 0) {
+			uart_irq_tx_disable(dev);
+		}
+	}
+}
+
 static void cdc_uart_interrupt_handler(const struct device *dev, void *user_data)
 {
 	int dev_idx = (int) user_data;
 
 	uart_irq_update(dev);
+
+	if (uart_irq_tx_ready(dev)) {
+		cdc_tx_process(dev, dev_idx);
+	}
+
 	if (!uart_irq_rx_ready(dev)) {
 		return;
 	}
 
-	void *rx_buf;
-	int err;
+	struct cdc_rx_buf *rx_buf;
 	int data_length;
 
 	poll_dtr();
 
 	do {
-		err = k_mem_slab_alloc(&cdc_rx_slab, &rx_buf, K_NO_WAIT);
-		if (err) {
-			do {
-				data_length = uart_fifo_read(
-					dev,
-					overflow_buf,
-					sizeof(overflow_buf));
-				LOG_WRN("CDC_%d RX overflow", dev_idx);
-			} while (data_length == sizeof(overflow_buf));
+		rx_buf = cdc_rx_buf_alloc(dev_idx);
+		if (rx_buf == NULL) {
+			/* Leave the data in the driver until a block is released. */
+			/* The driver NAKs the host when its buffer is full. */
+			LOG_DBG("CDC_%d RX paused", dev_idx);
+			uart_irq_rx_disable(dev);
+			atomic_set_bit(cdc_rx_paused, dev_idx);
+
+			/* A block may have been released before the flag was set */
+			if (atomic_get(&cdc_rx_block_count[dev_idx]) < CONFIG_BRIDGE_CDC_BUF_COUNT) {
+				k_work_submit(&cdc_rx_resume_work);
+			}
 			return;
 		}
 
 		data_length = uart_fifo_read(
 			dev,
-			rx_buf,
-			USB_CDC_RX_BLOCK_SIZE);
+			rx_buf->buf,
+			sizeof(rx_buf->buf));
 
 		if (data_length == 0) {
-			k_mem_slab_free(&cdc_rx_slab, rx_buf);
+			cdc_rx_buf_free(rx_buf);
 			return;
 		}
 
 		struct cdc_data_event *event = new_cdc_data_event();
 
 		event->dev_idx = dev_idx;
-		event->buf = rx_buf;
+		event->buf = rx_buf->buf;
 		event->len = data_length;
 		APP_EVENT_SUBMIT(event);
 
@@ -188,7 +378,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 	if (is_uart_data_event(aeh)) {
 		const struct uart_data_event *event =
 			cast_uart_data_event(aeh);
-		int tx_written;
+		int err;
 
 		if (event->dev_idx >= CDC_DEVICE_COUNT) {
 			return false;
@@ -198,17 +388,17 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			return false;
 		}
 
-		tx_written = uart_fifo_fill(
-			devices[event->dev_idx],
-			event->buf,
-			event->len);
-
-		if (tx_written != event->len) {
-			LOG_DBG("UART_%d->CDC_%d overflow",
+		/* The UART data is held until the CDC ACM driver accepts it */
+		err = cdc_tx_enqueue(event->dev_idx, event->buf, event->len);
+		if (err) {
+			LOG_WRN("UART_%d->CDC_%d overflow",
 				event->dev_idx,
 				event->dev_idx);
+			return false;
 		}
 
+		uart_irq_tx_enable(devices[event->dev_idx]);
+
 		return false;
 	}
 
@@ -216,8 +406,8 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		const struct cdc_data_event *event =
 			cast_cdc_data_event(aeh);
 
-		/* All subscribers have gotten a chance to copy data at this point */
-		k_mem_slab_free(&cdc_rx_slab, (void *)event->buf);
+		/* All subscribers have gotten a chance to copy or hold data at this point */
+		cdc_data_release(event->buf);
 
 		return true;
 	}
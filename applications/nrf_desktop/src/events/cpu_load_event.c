@@ -14,8 +14,18 @@ static void log_cpu_load_event(const struct app_event_header *aeh)
 {
 	const struct cpu_load_event *event = cast_cpu_load_event(aeh);
 
-	APP_EVENT_MANAGER_LOG(aeh, "CPU load: %03u,%03u%%",
-			event->load / 1000, event->load % 1000);
+	if (event->top_thread || (event->top_irq >= 0)) {
+		APP_EVENT_MANAGER_LOG(aeh,
+			"CPU load: %03u,%03u%% thread %p p99: %03u,%03u%% irq %d p99: %03u,%03u%%",
+			event->load / 1000, event->load % 1000,
+			(void *)event->top_thread,
+			event->top_thread_load.p99 / 1000, event->top_thread_load.p99 % 1000,
+			event->top_irq,
+			event->top_irq_load.p99 / 1000, event->top_irq_load.p99 % 1000);
+	} else {
+		APP_EVENT_MANAGER_LOG(aeh, "CPU load: %03u,%03u%%",
+				event->load / 1000, event->load % 1000);
+	}
 }
 
 static void profile_cpu_load_event(struct log_event_buf *buf,
@@ -24,11 +34,21 @@ static void profile_cpu_load_event(struct log_event_buf *buf,
 	const struct cpu_load_event *event = cast_cpu_load_event(aeh);
 
 	nrf_profiler_log_encode_uint32(buf, event->load);
+	nrf_profiler_log_add_mem_address(buf, event->top_thread);
+	nrf_profiler_log_encode_uint32(buf, event->top_thread_load.p99);
+	nrf_profiler_log_encode_uint32(buf, event->top_thread_load.max);
+	nrf_profiler_log_encode_int16(buf, event->top_irq);
+	nrf_profiler_log_encode_uint32(buf, event->top_irq_load.p99);
+	nrf_profiler_log_encode_uint32(buf, event->top_irq_load.max);
 }
 
 APP_EVENT_INFO_DEFINE(cpu_load_event,
-		  ENCODE(NRF_PROFILER_ARG_U32),
-		  ENCODE("load"),
+		  ENCODE(NRF_PROFILER_ARG_U32,
+			 NRF_PROFILER_ARG_U32, NRF_PROFILER_ARG_U32, NRF_PROFILER_ARG_U32,
+			 NRF_PROFILER_ARG_S16, NRF_PROFILER_ARG_U32, NRF_PROFILER_ARG_U32),
+		  ENCODE("load",
+			 "top_thread", "top_thread_p99", "top_thread_max",
+			 "top_irq", "top_irq_p99", "top_irq_max"),
 		  profile_cpu_load_event);
 
 APP_EVENT_TYPE_DEFINE(cpu_load_event,
@@ -15,6 +15,7 @@
 
 #include <app_event_manager.h>
 #include <app_event_manager_profiler_tracer.h>
+#include <debug/cpu_load.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,6 +26,18 @@ struct cpu_load_event {
 	struct app_event_header header; /**< Event header. */
 
 	uint32_t load; /**< CPU load [in 0,001% units]. */
+
+	/** Thread with the highest 99th percentile load or NULL. Provided only if
+	 *  per-thread statistics are enabled (CONFIG_NRF_CPU_LOAD_STATS).
+	 */
+	const struct k_thread *top_thread;
+	struct cpu_load_dist top_thread_load; /**< Load of the top thread. */
+
+	/** Interrupt with the highest 99th percentile load or -1. Provided only if
+	 *  per-interrupt statistics are enabled (CONFIG_NRF_CPU_LOAD_STATS_IRQ).
+	 */
+	int16_t top_irq;
+	struct cpu_load_dist top_irq_load; /**< Load of the top interrupt. */
 };
 
 APP_EVENT_TYPE_DECLARE(cpu_load_event);
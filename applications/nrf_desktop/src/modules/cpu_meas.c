@@ -18,11 +18,47 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_CPU_MEAS_LOG_LEVEL);
 static struct k_work_delayable cpu_load_read;
 
 
+static void top_thread_get(struct cpu_load_event *event)
+{
+	struct cpu_load_thread_stats stats;
+
+	for (size_t i = 0; cpu_load_thread_stats_get(i, &stats) == 0; i++) {
+		if (!event->top_thread || (stats.load.p99 > event->top_thread_load.p99)) {
+			event->top_thread = stats.thread;
+			event->top_thread_load = stats.load;
+		}
+	}
+}
+
+static void top_irq_get(struct cpu_load_event *event)
+{
+	struct cpu_load_irq_stats stats;
+
+	for (size_t i = 0; cpu_load_irq_stats_get(i, &stats) == 0; i++) {
+		if ((event->top_irq < 0) || (stats.load.p99 > event->top_irq_load.p99)) {
+			event->top_irq = stats.irq;
+			event->top_irq_load = stats.load;
+		}
+	}
+}
+
 static void send_cpu_load_event(uint32_t load)
 {
 	struct cpu_load_event *event = new_cpu_load_event();
 
 	event->load = load;
+	event->top_thread = NULL;
+	event->top_thread_load = (struct cpu_load_dist){0};
+	event->top_irq = -1;
+	event->top_irq_load = (struct cpu_load_dist){0};
+
+	if (IS_ENABLED(CONFIG_NRF_CPU_LOAD_STATS)) {
+		top_thread_get(event);
+	}
+	if (IS_ENABLED(CONFIG_NRF_CPU_LOAD_STATS_IRQ)) {
+		top_irq_get(event);
+	}
+
 	APP_EVENT_SUBMIT(event);
 }
 
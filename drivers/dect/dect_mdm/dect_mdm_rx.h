@@ -12,13 +12,25 @@
 #define DECT_MDM_RX_OP_RX_DATA_WITH_PKT_PTR 1
 
 /**
- * @brief Add RX operation to message queue for processing.
+ * @brief Allocate an RX operation from the RX event pool.
+ *
+ * The caller fills in the returned event data and passes it to
+ * dect_mdm_rx_op_data_submit(). Can be called from ISR context.
+ *
  * @param event_id Event type identifier (DECT_MDM_RX_OP_*).
- * @param data Pointer to event data (must not be NULL).
- * @param data_size Size of event data (must be > 0).
- * @return 0 on success, -EINVAL for invalid params, -ENOMEM for allocation failure,
- *         -ENOBUFS if message queue is full.
+ * @return Pointer to the event data, sized for the data of any DECT_MDM_RX_OP_* event,
+ *         or NULL if the pool is exhausted.
+ */
+void *dect_mdm_rx_op_data_alloc(uint16_t event_id);
+
+/**
+ * @brief Queue an RX operation allocated with dect_mdm_rx_op_data_alloc() for processing.
+ *
+ * The RX thread processes all queued operations in one batch and frees them.
+ * Can be called from ISR context.
+ *
+ * @param data Event data returned by dect_mdm_rx_op_data_alloc().
  */
-int dect_mdm_rx_msgq_data_op_add(uint16_t event_id, void *data, size_t data_size);
+void dect_mdm_rx_op_data_submit(void *data);
 
 #endif /* DECT_MDM_RX_H */
@@ -14,8 +14,10 @@
  *   via tail write.
  */
 
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/math_extras.h>
 
 LOG_MODULE_DECLARE(wifi_nrf, CONFIG_WIFI_NRF71_LOG_LEVEL);
 
@@ -40,22 +42,36 @@ static int (*callback_func)(void *data);
 
 #define IPC_TX_ACK_SLOTS 64
 
+BUILD_ASSERT(IPC_TX_ACK_SLOTS <= 64, "Pending slots are tracked in a 64-bit mask");
+
 static K_MUTEX_DEFINE(host_tx_ack_lock);
 static uint32_t host_tx_ack_slots[IPC_TX_ACK_SLOTS];
 static const void *host_tx_pending_bufs[IPC_TX_ACK_SLOTS];
+static uint32_t host_tx_send_cycles[IPC_TX_ACK_SLOTS];
+/* Bit set for each slot with a pending buffer, so that only those need to be checked */
+static uint64_t host_tx_pending_mask;
+static uint32_t host_tx_pending_cnt;
+static struct ipc_tx_stats host_tx_stats;
 
 static void host_tx_reclaim_completed(void)
 {
+	uint64_t pending;
+	uint32_t latency_us;
 	int i;
 
 	k_mutex_lock(&host_tx_ack_lock, K_FOREVER);
 
-	for (i = 0; i < IPC_TX_ACK_SLOTS; i++) {
+	pending = host_tx_pending_mask;
+
+	while (pending != 0U) {
 		uint32_t completed_addr;
 
+		i = u64_count_trailing_zeros(pending);
+		pending &= pending - 1U;
+
 		completed_addr = host_tx_ack_slots[i];
 
-		if ((completed_addr == 0U) || (host_tx_pending_bufs[i] == NULL)) {
+		if (completed_addr == 0U) {
 			continue;
 		}
 
@@ -69,6 +85,13 @@ static void host_tx_reclaim_completed(void)
 		nrf_wifi_osal_mem_free((void *)host_tx_pending_bufs[i]);
 		host_tx_pending_bufs[i] = NULL;
 		host_tx_ack_slots[i] = 0U;
+		host_tx_pending_mask &= ~BIT64(i);
+		host_tx_pending_cnt--;
+
+		latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - host_tx_send_cycles[i]);
+		host_tx_stats.completed++;
+		host_tx_stats.latency_sum_us += latency_us;
+		host_tx_stats.latency_max_us = MAX(host_tx_stats.latency_max_us, latency_us);
 	}
 
 	k_mutex_unlock(&host_tx_ack_lock);
@@ -76,25 +99,34 @@ static void host_tx_reclaim_completed(void)
 
 static uint32_t *host_tx_ack_slot_alloc(const void *data)
 {
+	uint64_t free_mask;
 	int i;
 
 	k_mutex_lock(&host_tx_ack_lock, K_FOREVER);
 
-	for (i = 0; i < IPC_TX_ACK_SLOTS; i++) {
-		if (host_tx_pending_bufs[i] != NULL) {
-			continue;
-		}
+	free_mask = ~host_tx_pending_mask;
+#if IPC_TX_ACK_SLOTS < 64
+	free_mask &= BIT64_MASK(IPC_TX_ACK_SLOTS);
+#endif
 
-		host_tx_ack_slots[i] = 0U;
-		host_tx_pending_bufs[i] = data;
+	if (free_mask == 0U) {
+		host_tx_stats.failed++;
 		k_mutex_unlock(&host_tx_ack_lock);
-
-		return &host_tx_ack_slots[i];
+		return NULL;
 	}
 
+	i = u64_count_trailing_zeros(free_mask);
+
+	host_tx_ack_slots[i] = 0U;
+	host_tx_pending_bufs[i] = data;
+	host_tx_send_cycles[i] = k_cycle_get_32();
+	host_tx_pending_mask |= BIT64(i);
+	host_tx_pending_cnt++;
+	host_tx_stats.pending_max = MAX(host_tx_stats.pending_max, host_tx_pending_cnt);
+
 	k_mutex_unlock(&host_tx_ack_lock);
 
-	return NULL;
+	return &host_tx_ack_slots[i];
 }
 
 static void host_tx_ack_slot_free(uint32_t *ack_addr)
@@ -105,21 +137,46 @@ static void host_tx_ack_slot_free(uint32_t *ack_addr)
 		return;
 	}
 
+	i = ack_addr - host_tx_ack_slots;
+	if ((i < 0) || (i >= IPC_TX_ACK_SLOTS)) {
+		return;
+	}
+
 	k_mutex_lock(&host_tx_ack_lock, K_FOREVER);
 
-	for (i = 0; i < IPC_TX_ACK_SLOTS; i++) {
-		if (&host_tx_ack_slots[i] != ack_addr) {
-			continue;
-		}
+	if (host_tx_pending_mask & BIT64(i)) {
+		host_tx_pending_mask &= ~BIT64(i);
+		host_tx_pending_cnt--;
+	}
+	host_tx_ack_slots[i] = 0U;
+	host_tx_pending_bufs[i] = NULL;
 
-		host_tx_ack_slots[i] = 0U;
-		host_tx_pending_bufs[i] = NULL;
-		break;
+	k_mutex_unlock(&host_tx_ack_lock);
+}
+
+static void host_tx_result_count(bool sent)
+{
+	k_mutex_lock(&host_tx_ack_lock, K_FOREVER);
+
+	if (sent) {
+		host_tx_stats.sent++;
+	} else {
+		host_tx_stats.failed++;
 	}
 
 	k_mutex_unlock(&host_tx_ack_lock);
 }
 
+void ipc_tx_stats_get(struct ipc_tx_stats *stats)
+{
+	k_mutex_lock(&host_tx_ack_lock, K_FOREVER);
+
+	*stats = host_tx_stats;
+	stats->pending = host_tx_pending_cnt;
+
+	k_mutex_unlock(&host_tx_ack_lock);
+}
+
 /* RX path: receive event (addr, size, ring); after handler, free by writing tail to GDRAM */
 static void host_rx_recv(void *data, size_t len, void *priv)
 {
@@ -160,6 +217,9 @@ int ipc_init(void)
 		host_tx_ack_slots[i] = 0U;
 		host_tx_pending_bufs[i] = NULL;
 	}
+	host_tx_pending_mask = 0U;
+	host_tx_pending_cnt = 0U;
+	memset(&host_tx_stats, 0, sizeof(host_tx_stats));
 
 	LOG_DBG("IPC host single endpoint (ipc0) TX+RX initialized");
 	return 0;
@@ -201,6 +261,8 @@ int ipc_send(ipc_ctx_t ctx, const void *data, int len)
 						       ack_addr);
 		} while (status == WIFI_IPC_STATUS_BUSYQ_NOTREADY);
 
+		host_tx_result_count(status == WIFI_IPC_STATUS_OK);
+
 		if (status != WIFI_IPC_STATUS_OK) {
 			host_tx_ack_slot_free(ack_addr);
 
@@ -37,6 +37,29 @@ struct rpu_dev {
 
 struct rpu_dev *rpu_dev(void);
 
+/**
+ * struct ipc_tx_stats - Statistics of the messages sent from the host to the RPU.
+ * @sent: Number of messages sent.
+ * @failed: Number of messages that could not be sent.
+ * @pending: Number of sent messages whose buffers have not yet been reclaimed.
+ * @pending_max: Highest number of pending messages.
+ * @completed: Number of messages reclaimed after the RPU completed them.
+ * @latency_sum_us: Sum of the times from sending to reclaiming a message.
+ * @latency_max_us: Longest time from sending to reclaiming a message.
+ *
+ * Completed messages are reclaimed when the next message is sent, so at low
+ * message rates the latency is longer than the processing time in the RPU.
+ */
+struct ipc_tx_stats {
+	uint32_t sent;
+	uint32_t failed;
+	uint32_t pending;
+	uint32_t pending_max;
+	uint32_t completed;
+	uint64_t latency_sum_us;
+	uint32_t latency_max_us;
+};
+
 int ipc_init(void);
 int ipc_deinit(void);
 int ipc_send(ipc_ctx_t ctx, const void *data, int len);
@@ -44,5 +67,6 @@ int ipc_send(ipc_ctx_t ctx, const void *data, int len);
 int ipc_recv(ipc_ctx_t ctx, void *data, int len);
 /* Non-blocking Receive (global, not per instance) */
 int ipc_register_rx_cb(int (*rx_handler)(void *priv), void *data);
+void ipc_tx_stats_get(struct ipc_tx_stats *stats);
 
 #endif /* __IPC_IF_H__ */
@@ -498,6 +498,49 @@ void *net_pkt_to_nbuf(struct net_pkt *pkt)
 	return nbuff;
 }
 
+#ifdef CONFIG_NRF_WIFI_ZERO_COPY_RX
+static void rx_zc_buf_destroy(struct net_buf *buf);
+
+/* Buffers carry no data of their own, they only reference the data of a received nbuf */
+NET_BUF_POOL_HEAP_DEFINE(rx_zc_pool, CONFIG_NRF_WIFI_ZERO_COPY_RX_BUFS,
+			 sizeof(struct nwb *), rx_zc_buf_destroy);
+
+static void rx_zc_buf_destroy(struct net_buf *buf)
+{
+	struct nwb *nwb = *(struct nwb **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+	zep_shim_nbuf_free(nwb);
+}
+
+static struct net_pkt *net_pkt_from_nbuf_zc(struct net_if *iface, struct nwb *nwb)
+{
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+
+	buf = net_buf_alloc_with_data(&rx_zc_pool, zep_shim_nbuf_data_get(nwb),
+				      zep_shim_nbuf_data_size(nwb), K_NO_WAIT);
+	if (!buf) {
+		/* All buffers are still held by the network stack */
+		return NULL;
+	}
+	*(struct nwb **)net_buf_user_data(buf) = NULL;
+
+	pkt = net_pkt_rx_alloc_on_iface(iface, K_MSEC(100));
+	if (!pkt) {
+		/* No nbuf is attached yet, so this does not free it */
+		net_buf_unref(buf);
+		return NULL;
+	}
+
+	/* From here on the nbuf is freed when the network stack releases the buffer */
+	*(struct nwb **)net_buf_user_data(buf) = nwb;
+	net_pkt_append_buffer(pkt, buf);
+
+	return pkt;
+}
+#endif /* CONFIG_NRF_WIFI_ZERO_COPY_RX */
+
 void *net_pkt_from_nbuf(void *iface, void *frm)
 {
 	struct net_pkt *pkt = NULL;
@@ -509,6 +552,14 @@ void *net_pkt_from_nbuf(void *iface, void *frm)
 		return NULL;
 	}
 
+#ifdef CONFIG_NRF_WIFI_ZERO_COPY_RX
+	pkt = net_pkt_from_nbuf_zc(iface, nwb);
+	if (pkt) {
+		return pkt;
+	}
+	/* Fall back to the copy path */
+#endif /* CONFIG_NRF_WIFI_ZERO_COPY_RX */
+
 	len = zep_shim_nbuf_data_size(nwb);
 
 	data = zep_shim_nbuf_data_get(nwb);
@@ -15,6 +15,7 @@
 #include "system/fmac_api.h"
 #include "fmac_main.h"
 #include "shim.h"
+#include "ipc_if.h"
 #include "wifi_util.h"
 
 
@@ -277,6 +278,7 @@ static int nrf_wifi_util_tx_stats(const struct shell *sh,
 	void *queue = NULL;
 	unsigned int tx_pending_pkts = 0;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct ipc_tx_stats ipc_stats;
 	int ret;
 
 	vif_index = atoi(argv[1]);
@@ -320,6 +322,20 @@ static int nrf_wifi_util_tx_stats(const struct shell *sh,
 			tx_pending_pkts);
 	}
 
+	ipc_tx_stats_get(&ipc_stats);
+
+	shell_fprintf(sh,
+		      SHELL_INFO,
+		      "IPC messages: sent: %u, failed: %u, pending: %u (max: %u)\n"
+		      "IPC completion latency: avg: %u us, max: %u us\n",
+		      ipc_stats.sent,
+		      ipc_stats.failed,
+		      ipc_stats.pending,
+		      ipc_stats.pending_max,
+		      ipc_stats.completed ?
+		      (uint32_t)(ipc_stats.latency_sum_us / ipc_stats.completed) : 0,
+		      ipc_stats.latency_max_us);
+
 	ret = 0;
 
 unlock:
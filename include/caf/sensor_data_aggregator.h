@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SENSOR_DATA_AGGREGATOR_H_
+#define _SENSOR_DATA_AGGREGATOR_H_
+
+/**
+ * @file
+ * @defgroup caf_sensor_data_aggregator CAF Sensor Data Aggregator
+ * @{
+ * @brief CAF Sensor Data Aggregator direct write API.
+ *
+ * The API allows a sensor data producer that runs on the same core as the sensor data
+ * aggregator to write samples directly into the aggregator buffers, without an intermediate
+ * @ref sensor_event. The aggregator buffers are used as a ring. Every filled buffer is
+ * passed to the consumers as a contiguous window using @ref sensor_data_aggregator_event.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/drivers/sensor.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Claim space for samples in the active aggregator buffer.
+ *
+ * On success, the producer can write samples to the returned location. The number of written
+ * samples must be provided using @ref sensor_data_aggregator_commit. Only one claim can be
+ * active for an aggregator at a time.
+ *
+ * The space never wraps around the end of the aggregator buffer. If the returned number of
+ * samples is smaller than required, the remaining samples must be written after the claimed
+ * samples are committed.
+ *
+ * @param[in]  sensor_descr     Sensor description. The same pointer as used by the aggregator
+ *                              configuration.
+ * @param[in]  values_in_sample Number of sensor values in a single sample.
+ * @param[out] samples          Location to which the samples should be written.
+ *
+ * @retval Positive value Number of samples that can be written.
+ * @retval -ENOENT        No aggregator is configured for the sensor.
+ * @retval -EBADMSG       Sample size does not match the aggregator configuration.
+ * @retval -ENOMEM        No free buffer. All of the buffers are processed by consumers.
+ * @retval -EBUSY         Other claim for the aggregator is in progress.
+ */
+int sensor_data_aggregator_claim(const char *sensor_descr, uint8_t values_in_sample,
+				 struct sensor_value **samples);
+
+/** @brief Commit samples written to the claimed space.
+ *
+ * The aggregator buffer is passed to the consumers when it becomes full.
+ *
+ * @param[in] sensor_descr Sensor description.
+ * @param[in] sample_cnt   Number of written samples. Can be zero.
+ */
+void sensor_data_aggregator_commit(const char *sensor_descr, size_t sample_cnt);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _SENSOR_DATA_AGGREGATOR_H_ */
@@ -13,6 +13,9 @@ extern "C" {
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/sensor.h>
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+#include <zephyr/rtio/rtio.h>
+#endif
 #include <caf/events/sensor_event.h>
 #include <caf/caf_sensor_common.h>
 
@@ -85,6 +88,22 @@ struct sm_sensor_config {
 	 * @brief Flag to indicate whether sensor should be suspended or not.
 	 */
 	bool suspend;
+#if defined(CONFIG_CAF_SENSOR_MANAGER_STREAMING) || defined(__DOXYGEN__)
+	/**
+	 * @brief Stream I/O device
+	 *
+	 * Optional I/O device used to read the sensor in streaming mode, defined using
+	 * the SENSOR_DT_STREAM_IODEV macro. The stream triggers (for example
+	 * SENSOR_TRIG_FIFO_WATERMARK) and the channels read by the I/O device are defined
+	 * by the application. If set, the sensor is not polled and the sampling period
+	 * defines the maximum interval at which the received stream data is processed.
+	 * Channels with data_cnt equal to 3 are decoded as three-axis data, the remaining
+	 * channels must have data_cnt equal to 1.
+	 *
+	 * Streamed sensors do not support sensor trigger configuration.
+	 */
+	struct rtio_iodev *stream_iodev;
+#endif
 };
 
 #ifdef __cplusplus
@@ -9,11 +9,14 @@
 
 #include <zephyr/types.h>
 #include <zephyr/toolchain.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+struct k_thread;
+
 /**
  * @defgroup cpu_load CPU load
  * @brief Module for measuring CPU load.
@@ -50,6 +53,71 @@ void cpu_load_reset(void);
  */
 int cpu_load_get(void);
 
+/** @brief Load distribution over the measurement windows.
+ *
+ * Values are represented in 0,001% units, the same as in @ref cpu_load_get.
+ * Percentiles are resolved to the histogram bucket width.
+ */
+struct cpu_load_dist {
+	/** Median load. */
+	uint32_t p50;
+	/** 99th percentile of the load. */
+	uint32_t p99;
+	/** Maximum load. */
+	uint32_t max;
+};
+
+/** @brief Load statistics of a thread. */
+struct cpu_load_thread_stats {
+	/** Thread. */
+	const struct k_thread *thread;
+	/** Load of the thread, including interrupts that preempted it. */
+	struct cpu_load_dist load;
+};
+
+/** @brief Load statistics of an interrupt. */
+struct cpu_load_irq_stats {
+	/** Interrupt number. */
+	uint16_t irq;
+	/** Number of interrupt service routine executions. */
+	uint32_t count;
+	/** Longest single interrupt service routine execution [us]. */
+	uint32_t isr_max_us;
+	/** Load of the interrupt, excluding nested interrupts. */
+	struct cpu_load_dist load;
+};
+
+/** @brief Get load statistics of a tracked thread.
+ *
+ * Available if @kconfig{CONFIG_NRF_CPU_LOAD_STATS} is enabled.
+ *
+ * @param idx Index of the tracked thread, starting from 0.
+ * @param stats Pointer to the structure to be filled.
+ *
+ * @retval 0 The statistics are provided.
+ * @retval -ENOENT No tracked thread with the given index.
+ */
+int cpu_load_thread_stats_get(size_t idx, struct cpu_load_thread_stats *stats);
+
+/** @brief Get load statistics of a tracked interrupt.
+ *
+ * Available if @kconfig{CONFIG_NRF_CPU_LOAD_STATS_IRQ} is enabled.
+ *
+ * @param idx Index of the tracked interrupt, starting from 0.
+ * @param stats Pointer to the structure to be filled.
+ *
+ * @retval 0 The statistics are provided.
+ * @retval -ENOENT No tracked interrupt with the given index.
+ */
+int cpu_load_irq_stats_get(size_t idx, struct cpu_load_irq_stats *stats);
+
+/** @brief Reset the per-thread and per-interrupt load statistics.
+ *
+ * Unlike @ref cpu_load_reset, the statistics are not reset when the
+ * overall load measurement is.
+ */
+void cpu_load_stats_reset(void);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -96,6 +96,21 @@ const char *ei_wrapper_get_classifier_label(size_t idx);
 int ei_wrapper_add_data(const float *data, size_t data_size);
 
 
+/** Add 16-bit integer input data for the library.
+ *
+ * Size of the added data must be divisible by input frame size.
+ * The data is converted to floating-point values when it is read by the library.
+ *
+ * @param[in] data       Pointer to the buffer with input data.
+ * @param[in] data_size  Size of the data (number of integer values).
+ *
+ * @retval 0        If the operation was successful.
+ * @retval -ENOTSUP If the :kconfig:option:`CONFIG_EI_WRAPPER_DATA_INT16` option is disabled.
+ *                  Otherwise, a (negative) error code is returned.
+ */
+int ei_wrapper_add_data_int16(const int16_t *data, size_t data_size);
+
+
 /** Clear all buffered data.
  *
  * The buffer cannot be cleared if the prediction was already started and the
@@ -189,6 +204,43 @@ int ei_wrapper_get_timing(int *dsp_time, int *classification_time,
 			  int *anomaly_time);
 
 
+/** @brief Detailed execution times of the prediction. */
+struct ei_wrapper_timing {
+	/** Time spent on DSP processing in ms. */
+	int dsp_time;
+
+	/** Time spent on classification in ms. */
+	int classification_time;
+
+	/** Time spent on anomaly detection in ms or -1 if anomaly is not supported. */
+	int anomaly_time;
+
+	/** Total time of the prediction measured by the wrapper in us. */
+	uint32_t total_time_us;
+
+	/** Number of input values processed by DSP. Smaller than the window size if the
+	 *  features of the part of the window that overlaps the previous window were reused.
+	 */
+	size_t dsp_input_size;
+};
+
+
+/** Get detailed execution times of the prediction.
+ *
+ * This function can be executed only from the wrapper's callback context.
+ * Otherwise, it returns a (negative) error code.
+ *
+ * If the :kconfig:option:`CONFIG_EI_WRAPPER_INCREMENTAL` option is enabled and the window is
+ * processed in more than one step, the times are sums over all steps.
+ *
+ * @param[out] timing Pointer to the structure that is used to store the execution times.
+ *
+ * @retval 0       On success.
+ * @retval -EACCES If function is executed from other context that the wrapper's callback.
+ */
+int ei_wrapper_get_timing_details(struct ei_wrapper_timing *timing);
+
+
 /** Initialize the Edge Impulse wrapper.
  *
  * @param[in] cb Callback used to receive results.
@@ -309,6 +309,19 @@ struct esb_evt {
 	uint32_t tx_attempts;	/**< Number of TX retransmission attempts. */
 };
 
+/** @brief Per-pipe transfer statistics.
+ *
+ *  Available when the CONFIG_ESB_PIPE_STATS Kconfig option is enabled.
+ */
+struct esb_pipe_stats {
+	uint32_t tx_packets;	 /**< Packets transmitted successfully, including ACK payloads. */
+	uint32_t tx_bytes;	 /**< Payload bytes transmitted successfully. */
+	uint32_t tx_failed;	 /**< Packets not acknowledged after all retransmission attempts. */
+	uint32_t tx_retransmits; /**< Retransmissions of packets. */
+	uint32_t rx_packets;	 /**< Packets received, including ACK payloads. */
+	uint32_t rx_bytes;	 /**< Payload bytes received. */
+};
+
 /** @brief Event handler prototype. */
 typedef void (*esb_event_handler)(const struct esb_evt *event);
 
@@ -616,6 +629,30 @@ int esb_set_bitrate(enum esb_bitrate bitrate);
  */
 int esb_reuse_pid(uint8_t pipe);
 
+#if defined(CONFIG_ESB_PIPE_STATS) || defined(__DOXYGEN__)
+/** @brief Get the transfer statistics of a pipe.
+ *
+ *  The counters are updated from the radio interrupt handler and wrap around
+ *  on overflow.
+ *
+ *  @param[in]  pipe	Pipe.
+ *  @param[out] stats	Statistics of the pipe.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_get_pipe_stats(uint8_t pipe, struct esb_pipe_stats *stats);
+
+/** @brief Reset the transfer statistics of a pipe.
+ *
+ *  @param[in] pipe	Pipe.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_reset_pipe_stats(uint8_t pipe);
+#endif /* defined(CONFIG_ESB_PIPE_STATS) || defined(__DOXYGEN__) */
+
 /** @} */
 
 #ifdef __cplusplus
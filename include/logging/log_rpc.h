@@ -47,6 +47,21 @@ struct nrf_rpc_crash_info {
 	char assert_filename[CONFIG_LOG_BACKED_RPC_CRASH_INFO_FILENAME_SIZE];
 };
 
+/**
+ * @brief Log streaming statistics.
+ *
+ * The statistics cover the log messages received by the log forwarder since the last call
+ * to @ref log_rpc_reset_stream_stats, and can be used to compare the streaming modes.
+ */
+struct log_rpc_stream_stats {
+	/** Number of received log messages. */
+	uint32_t messages;
+	/** Number of nRF RPC events that carried the log messages. */
+	uint32_t events;
+	/** Total payload size of the nRF RPC events, in bytes. */
+	uint32_t bytes;
+};
+
 /**
  * @brief Log history handler.
  *
@@ -225,6 +240,19 @@ int log_rpc_get_crash_info(struct nrf_rpc_crash_info *info);
  */
 void log_rpc_echo(enum log_rpc_level level, const char *message);
 
+/**
+ * @brief Generates a number of log messages on the remote device.
+ *
+ * This function issues a single nRF RPC command that requests the remote device to
+ * generate the given number of log messages, so it can be used to measure the log
+ * streaming throughput without the round-trip time of a command per message.
+ *
+ * @param level		Logging level, see @ref log_rpc_level.
+ * @param message	Log message C string.
+ * @param count		Number of log messages to generate.
+ */
+void log_rpc_echo_count(enum log_rpc_level level, const char *message, uint32_t count);
+
 /**
  * @brief Sets the current time used for log timestamping.
  *
@@ -240,6 +268,18 @@ void log_rpc_echo(enum log_rpc_level level, const char *message);
  */
 void log_rpc_set_time(uint64_t now_us);
 
+/**
+ * @brief Gets the log streaming statistics.
+ *
+ * @param[out] stats	Log streaming statistics.
+ */
+void log_rpc_get_stream_stats(struct log_rpc_stream_stats *stats);
+
+/**
+ * @brief Resets the log streaming statistics.
+ */
+void log_rpc_reset_stream_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
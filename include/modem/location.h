@@ -64,6 +64,14 @@ enum location_req_mode {
 	LOCATION_REQ_MODE_FALLBACK = 0,
 	/** All requested methods are used sequentially. */
 	LOCATION_REQ_MODE_ALL,
+	/**
+	 * Requested methods are used concurrently. Wi-Fi and cellular are always combined into
+	 * a single cloud request, which is run at the same time as GNSS. The first location
+	 * meeting @ref location_config.accuracy_target is returned.
+	 *
+	 * Requires @kconfig{CONFIG_LOCATION_REQ_MODE_CONCURRENT}.
+	 */
+	LOCATION_REQ_MODE_CONCURRENT,
 };
 
 /** Event IDs. */
@@ -219,6 +227,8 @@ struct location_data_details {
 	 * This is the time from method start until it completes and includes any time
 	 * spent waiting for some conditions to happen before proceeding, such as
 	 * waiting for LTE connection to go idle for some methods.
+	 * In @ref LOCATION_REQ_MODE_CONCURRENT, this is the time from the start of the
+	 * location request, because all methods are started at the same time.
 	 */
 	uint32_t elapsed_time_method;
 
@@ -570,6 +580,21 @@ struct location_config {
 	 * location_config_defaults_set() function is called.
 	 */
 	enum location_req_mode mode;
+
+	/**
+	 * @brief Accuracy target (in meters) for @ref LOCATION_REQ_MODE_CONCURRENT.
+	 *
+	 * @details The first location with an accuracy equal to or better than the target is
+	 * returned and the other methods are cancelled. If none of the methods meets the target,
+	 * the most accurate location is returned once all methods have completed or the request
+	 * has timed out. Zero means that the first acquired location is returned.
+	 * Not used in other modes.
+	 *
+	 * Default value is 0. It is applied when location_config_defaults_set() function is
+	 * called and can be changed at build time with
+	 * @kconfig{CONFIG_LOCATION_REQUEST_DEFAULT_ACCURACY_TARGET} configuration.
+	 */
+	float accuracy_target;
 };
 
 /**
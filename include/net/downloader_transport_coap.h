@@ -27,6 +27,12 @@ struct downloader_transport_coap_cfg {
 	enum coap_block_size block_size;
 	/** Max retransmission requests. */
 	uint8_t max_retransmission;
+	/** Maximum number of block requests in flight.
+	 *  Values of 0 and 1 request one block at a time. The value is limited by the
+	 *  @kconfig{CONFIG_DOWNLOADER_TRANSPORT_COAP_WINDOW_MAX} Kconfig option and by the
+	 *  number of blocks that fit in the download buffer.
+	 */
+	uint8_t window_size;
 };
 
 /**
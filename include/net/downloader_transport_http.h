@@ -24,6 +24,11 @@
 struct downloader_transport_http_cfg {
 	/** Socket receive timeout in milliseconds. The default timeout is 30000 ms. */
 	uint32_t sock_recv_timeo_ms;
+	/** Maximum number of range requests outstanding on the connection.
+	 *  Zero selects the value of the @kconfig{CONFIG_DOWNLOADER_TRANSPORT_HTTP_PIPELINE_DEPTH}
+	 *  Kconfig option. Pipelining is used only for range requests.
+	 */
+	uint8_t pipeline_depth;
 };
 
 /**
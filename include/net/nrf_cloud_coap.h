@@ -101,6 +101,17 @@ struct nrf_cloud_coap_location_request {
 	const struct nrf_cloud_location_config *config;
 };
 
+/**
+ * @brief Completion callback for asynchronous nRF Cloud CoAP requests.
+ *
+ * Called from the CoAP client thread once the request has finished.
+ *
+ * @param result 0 if the request succeeded, a positive value indicating a CoAP result code,
+ *               or a negative error number.
+ * @param user   User data passed when the request was started.
+ */
+typedef void (*nrf_cloud_coap_done_cb_t)(int result, void *user);
+
 /**
  * @defgroup nrf_cloud_coap nRF CoAP API
  *
@@ -564,6 +575,69 @@ int nrf_cloud_coap_bytes_send(uint8_t *buf, size_t buf_len, bool confirmable);
  */
 int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable);
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+/**
+ * @brief Send a sensor value to nRF Cloud without waiting for the response.
+ *
+ * The request is always sent as a CON CoAP transfer. The function returns as soon as the
+ * request has been sent; the result is reported through @p done_cb.
+ *
+ * @param[in]     app_id The app_id identifying the type of data. See the values in nrf_cloud_defs.h
+ *                       that begin with  NRF_CLOUD_JSON_APPID_. You may also use custom names.
+ * @param[in]     value Sensor reading.
+ * @param[in]     ts_ms Timestamp the data was measured, or NRF_CLOUD_NO_TIMESTAMP.
+ * @param[in]     done_cb Callback called when the request has completed.
+ * @param[in]     user User data passed to @p done_cb.
+ *
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval -EAGAIN Maximum number of requests are already in flight.
+ * @return 0 if the request was sent, otherwise a negative error number.
+ */
+int nrf_cloud_coap_sensor_send_async(const char *app_id, double value, int64_t ts_ms,
+				     nrf_cloud_coap_done_cb_t done_cb, void *user);
+
+/**
+ * @brief Update the reported state of the device shadow without waiting for the response.
+ *
+ * @param[in]     shadow_json JSON string to be sent.
+ * @param[in]     done_cb Callback called when the request has completed.
+ * @param[in]     user User data passed to @p done_cb.
+ *
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval -EAGAIN Maximum number of requests are already in flight.
+ * @retval -EMSGSIZE The JSON string is larger than CONFIG_NRF_CLOUD_COAP_ASYNC_PAYLOAD_SIZE.
+ * @return 0 if the request was sent, otherwise a negative error number.
+ */
+int nrf_cloud_coap_shadow_state_update_async(const char * const shadow_json,
+					     nrf_cloud_coap_done_cb_t done_cb, void *user);
+
+/**
+ * @brief Add a JSON message to the pending batch.
+ *
+ * Messages are collected into a JSON array that is sent to the d2c/bulk topic by
+ * @ref nrf_cloud_coap_batch_flush, so several small messages share one request.
+ *
+ * @param[in]     message JSON message, as accepted by @ref nrf_cloud_coap_json_message_send.
+ *
+ * @retval -ENOMEM The message does not fit in the batch; flush the batch and try again.
+ * @return 0 if the message was added to the batch.
+ */
+int nrf_cloud_coap_json_message_batch_add(const char *message);
+
+/**
+ * @brief Send the pending batch of JSON messages without waiting for the response.
+ *
+ * @param[in]     done_cb Callback called when the request has completed.
+ * @param[in]     user User data passed to @p done_cb.
+ *
+ * @retval -ENODATA The batch is empty.
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval -EAGAIN Maximum number of requests are already in flight. The batch is kept.
+ * @return 0 if the batch was sent, otherwise a negative error number.
+ */
+int nrf_cloud_coap_batch_flush(nrf_cloud_coap_done_cb_t done_cb, void *user);
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 /** @} */
 
 #ifdef __cplusplus
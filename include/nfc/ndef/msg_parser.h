@@ -15,6 +15,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <zephyr/types.h>
 #include <nfc/ndef/record_parser.h>
 #include <nfc/ndef/msg.h>
@@ -84,6 +85,93 @@ struct nfc_ndef_msg_parser_msg_2 {
 int nfc_ndef_msg_parse(uint8_t *result_buf, uint32_t *result_buf_len, const uint8_t *raw_data,
 		       uint32_t *raw_data_len);
 
+/** @brief Iterator over the records of a raw NDEF message.
+ *
+ *  The iterator walks the raw NDEF data in place. Records are parsed and
+ *  validated one at a time, only when requested.
+ */
+struct nfc_ndef_msg_iter {
+	/** Pointer to the part of the message that is not parsed yet. */
+	const uint8_t *data;
+
+	/** Length of the part of the message that is not parsed yet. */
+	uint32_t data_len;
+
+	/** Number of records returned so far. */
+	uint32_t record_count;
+
+	/** Set after the last record of the message is returned. */
+	bool end;
+};
+
+/** @brief Record matching function for @ref nfc_ndef_msg_record_find.
+ *
+ *  @param[in] rec_desc Pointer to the record descriptor to check.
+ *
+ *  @retval true If the record is the one being searched for.
+ */
+typedef bool (*nfc_ndef_record_match_t)(const struct nfc_ndef_record_desc *rec_desc);
+
+/** @brief Initialize an NDEF message iterator.
+ *
+ *  No data is parsed by this function.
+ *
+ *  @param[out] iter Pointer to the iterator.
+ *  @param[in] raw_data Pointer to the data to be parsed. The data must remain
+ *                      valid while the iterator and the records returned by it
+ *                      are in use.
+ *  @param[in] raw_data_len Size of the NFC data in the @p raw_data buffer.
+ */
+void nfc_ndef_msg_iter_init(struct nfc_ndef_msg_iter *iter, const uint8_t *raw_data,
+			    uint32_t raw_data_len);
+
+/** @brief Parse the next record of an NDEF message.
+ *
+ *  This function parses the next record header and validates that the record
+ *  fits in the data and that its location flags are correct. The record
+ *  descriptor points to the type, ID, and payload fields within the raw data.
+ *  These fields are not copied.
+ *
+ *  @param[in,out] iter Pointer to the iterator.
+ *  @param[out] rec_desc Pointer to the record descriptor that will be filled
+ *                       with parsed data.
+ *  @param[out] bin_pay_desc Pointer to the binary payload descriptor that
+ *                           will be filled and referenced by @p rec_desc.
+ *
+ *  @retval 0 If a record was parsed.
+ *  @retval -ENOENT If the last record of the message was already returned.
+ *  @retval -EINVAL If the record does not fit in the data.
+ *  @retval -EFAULT If the record location flags are invalid, or the data ends
+ *                  before the last record of the message.
+ */
+int nfc_ndef_msg_iter_next(struct nfc_ndef_msg_iter *iter,
+			   struct nfc_ndef_record_desc *rec_desc,
+			   struct nfc_ndef_bin_payload_desc *bin_pay_desc);
+
+/** @brief Find a record in an NDEF message.
+ *
+ *  This function walks the raw NDEF data in place and stops at the first
+ *  matching record. Records after it are not parsed. It can be used instead of
+ *  @ref nfc_ndef_msg_parse when only one record of the message is needed,
+ *  for example with @ref nfc_ndef_le_oob_rec_check as the @p match function.
+ *
+ *  @param[in] raw_data Pointer to the data to be parsed.
+ *  @param[in] raw_data_len Size of the NFC data in the @p raw_data buffer.
+ *  @param[in] match Record matching function.
+ *  @param[out] rec_desc Pointer to the record descriptor that will be filled
+ *                       with the matching record.
+ *  @param[out] bin_pay_desc Pointer to the binary payload descriptor that
+ *                           will be filled and referenced by @p rec_desc.
+ *
+ *  @retval 0 If a matching record was found.
+ *  @retval -ENOENT If the message does not contain a matching record.
+ *            Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_msg_record_find(const uint8_t *raw_data, uint32_t raw_data_len,
+			     nfc_ndef_record_match_t match,
+			     struct nfc_ndef_record_desc *rec_desc,
+			     struct nfc_ndef_bin_payload_desc *bin_pay_desc);
+
 /** @brief Print the parsed contents of an NDEF message.
  *
  *  @param[in] msg_desc Pointer to the descriptor of the message that should
@@ -229,6 +229,12 @@ void nfc_t4t_isodep_on_timeout(void);
  * This function prepares a buffer for the ISO-DEP protocol and
  * validates it size.
  *
+ * If the TX buffer can hold two frames of the size accepted by the tag,
+ * the next chained I-block is prepared while the current one is sent.
+ * The next block is prepared after the @ref nfc_t4t_isodep_cb.ready_to_send
+ * callback returns, so the response must not be passed to
+ * @ref nfc_t4t_isodep_data_received from within that callback.
+ *
  * @param[in,out] tx_buf  Buffer for TX data. Data is set there before sending.
  * @param[in] tx_size     Size of the TX buffer.
  * @param[in,out] rx_buf Buffer for RX data. Data is set there after
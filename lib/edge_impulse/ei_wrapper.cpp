@@ -33,6 +33,20 @@ BUILD_ASSERT(CONFIG_EI_WRAPPER_THREAD_STACK_SIZE > 0);
 #define THREAD_PRIORITY 	CONFIG_EI_WRAPPER_THREAD_PRIORITY
 #define DEBUG_MODE		IS_ENABLED(CONFIG_EI_WRAPPER_DEBUG_MODE)
 
+#if CONFIG_EI_WRAPPER_INCREMENTAL
+#define INPUT_SLICE_SIZE	EI_CLASSIFIER_SLICE_SIZE
+#define SLICES_IN_WINDOW	EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW
+
+BUILD_ASSERT(INPUT_SLICE_SIZE * SLICES_IN_WINDOW == INPUT_WINDOW_SIZE);
+BUILD_ASSERT(INPUT_SLICE_SIZE % INPUT_FRAME_SIZE == 0);
+#endif /* CONFIG_EI_WRAPPER_INCREMENTAL */
+
+#if CONFIG_EI_WRAPPER_DATA_INT16
+typedef int16_t data_t;
+#else
+typedef float data_t;
+#endif /* CONFIG_EI_WRAPPER_DATA_INT16 */
+
 enum state {
 	STATE_DISABLED,
 	STATE_WAITING_FOR_DATA,
@@ -41,10 +55,11 @@ enum state {
 };
 
 struct data_buffer {
-	float buf[DATA_BUFFER_SIZE];
+	data_t buf[DATA_BUFFER_SIZE];
 	size_t process_idx;
 	size_t append_idx;
 	size_t wait_data_size;
+	size_t last_move;
 	struct k_spinlock lock;
 	enum state state;
 };
@@ -59,6 +74,12 @@ static struct data_buffer ei_input;
 static ei_impulse_result_t ei_result;
 static int cur_res_idx;
 static ei_wrapper_result_ready_cb user_cb;
+static struct ei_wrapper_timing ei_timing;
+
+/* Offset of the data read by the library, relative to the processed window. */
+static size_t signal_offset;
+/* DSP features of the previous window are cached by the library. */
+static bool features_cached;
 
 
 BUILD_ASSERT(DATA_BUFFER_SIZE > INPUT_WINDOW_SIZE);
@@ -84,6 +105,30 @@ static size_t buf_calc_free_space(const struct data_buffer *b)
 	return ARRAY_SIZE(b->buf) - buf_get_collected_data_count(b) - 1;
 }
 
+#if CONFIG_EI_WRAPPER_DATA_INT16
+static bool buf_has_free_space(struct data_buffer *b, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&b->lock);
+	bool has_space = (buf_calc_free_space(b) >= len);
+
+	k_spin_unlock(&b->lock, key);
+
+	return has_space;
+}
+#endif /* CONFIG_EI_WRAPPER_DATA_INT16 */
+
+#if CONFIG_EI_WRAPPER_INCREMENTAL
+static size_t buf_get_last_move(struct data_buffer *b)
+{
+	k_spinlock_key_t key = k_spin_lock(&b->lock);
+	size_t move = b->last_move;
+
+	k_spin_unlock(&b->lock, key);
+
+	return move;
+}
+#endif /* CONFIG_EI_WRAPPER_INCREMENTAL */
+
 static void buf_processing_end(struct data_buffer *b)
 {
 	k_spinlock_key_t key = k_spin_lock(&b->lock);
@@ -111,6 +156,7 @@ static int buf_cleanup(struct data_buffer *b, bool *cancelled)
 		b->process_idx = 0;
 		b->append_idx = 0;
 		b->wait_data_size = 0;
+		b->last_move = 0;
 		b->state = STATE_READY;
 	}
 
@@ -119,7 +165,7 @@ static int buf_cleanup(struct data_buffer *b, bool *cancelled)
 	return err;
 }
 
-static int buf_append(struct data_buffer *b, const float *data, size_t len,
+static int buf_append(struct data_buffer *b, const data_t *data, size_t len,
 		      bool *process_buf)
 {
 	*process_buf = false;
@@ -167,6 +213,17 @@ static int buf_append(struct data_buffer *b, const float *data, size_t len,
 	return 0;
 }
 
+static void buf_copy_out(float *dst, const data_t *src, size_t len)
+{
+	if (IS_ENABLED(CONFIG_EI_WRAPPER_DATA_INT16)) {
+		for (size_t i = 0; i < len; i++) {
+			dst[i] = src[i];
+		}
+	} else {
+		memcpy(dst, src, len * sizeof(src[0]));
+	}
+}
+
 static void buf_get(const struct data_buffer *b, float *b_res, size_t offset,
 		    size_t len)
 {
@@ -181,15 +238,13 @@ static void buf_get(const struct data_buffer *b, float *b_res, size_t offset,
 	if ((read_end > ARRAY_SIZE(b->buf)) && (read_start < ARRAY_SIZE(b->buf))) {
 		size_t copy_cnt = ARRAY_SIZE(b->buf) - read_start;
 
-		memcpy(b_res, &b->buf[read_start],
-		       copy_cnt * sizeof(b->buf[0]));
-		memcpy(b_res + copy_cnt, &b->buf[0],
-		       (len - copy_cnt) * sizeof(b->buf[0]));
+		buf_copy_out(b_res, &b->buf[read_start], copy_cnt);
+		buf_copy_out(b_res + copy_cnt, &b->buf[0], len - copy_cnt);
 	} else {
 		if (read_start >= ARRAY_SIZE(b->buf)) {
 			read_start -= ARRAY_SIZE(b->buf);
 		}
-		memcpy(b_res, &b->buf[read_start], len * sizeof(b->buf[0]));
+		buf_copy_out(b_res, &b->buf[read_start], len);
 	}
 }
 
@@ -211,6 +266,7 @@ static int buf_processing_move(struct data_buffer *b, size_t move,
 	size_t max_move = buf_get_collected_data_count(b);
 
 	b->process_idx += move;
+	b->last_move = move;
 	if (b->process_idx >= ARRAY_SIZE(b->buf)) {
 		b->process_idx -= ARRAY_SIZE(b->buf);
 	}
@@ -265,7 +321,7 @@ const char *ei_wrapper_get_classifier_label(size_t idx)
 	return ei_classifier_inferencing_categories[idx];
 }
 
-int ei_wrapper_add_data(const float *data, size_t data_size)
+static int add_data(const data_t *data, size_t data_size)
 {
 	if (data_size % INPUT_FRAME_SIZE) {
 		return -EINVAL;
@@ -281,9 +337,62 @@ int ei_wrapper_add_data(const float *data, size_t data_size)
 	return err;
 }
 
+int ei_wrapper_add_data(const float *data, size_t data_size)
+{
+#if CONFIG_EI_WRAPPER_DATA_INT16
+	if (data_size % INPUT_FRAME_SIZE) {
+		return -EINVAL;
+	}
+
+	/* Data is appended frame by frame. Make sure that all of it fits, so that
+	 * the data is not added partially.
+	 */
+	if (!buf_has_free_space(&ei_input, data_size)) {
+		return -ENOMEM;
+	}
+
+	/* Convert data frame by frame to limit stack usage. */
+	data_t frame[INPUT_FRAME_SIZE];
+
+	for (size_t off = 0; off < data_size; off += INPUT_FRAME_SIZE) {
+		for (size_t i = 0; i < INPUT_FRAME_SIZE; i++) {
+			float val = roundf(data[off + i]);
+
+			frame[i] = (data_t)CLAMP(val, (float)INT16_MIN, (float)INT16_MAX);
+		}
+
+		int err = add_data(frame, ARRAY_SIZE(frame));
+
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+#else
+	return add_data(data, data_size);
+#endif /* CONFIG_EI_WRAPPER_DATA_INT16 */
+}
+
+int ei_wrapper_add_data_int16(const int16_t *data, size_t data_size)
+{
+#if CONFIG_EI_WRAPPER_DATA_INT16
+	return add_data(data, data_size);
+#else
+	return -ENOTSUP;
+#endif /* CONFIG_EI_WRAPPER_DATA_INT16 */
+}
+
 int ei_wrapper_clear_data(bool *cancelled)
 {
-	return buf_cleanup(&ei_input, cancelled);
+	int err = buf_cleanup(&ei_input, cancelled);
+
+	if (!err) {
+		/* Features are invalidated by the thread before the next prediction. */
+		features_cached = false;
+	}
+
+	return err;
 }
 
 int ei_wrapper_start_prediction(size_t window_shift, size_t frame_shift)
@@ -303,11 +412,80 @@ int ei_wrapper_start_prediction(size_t window_shift, size_t frame_shift)
 
 static int raw_feature_get_data(size_t offset, size_t length, float *out_ptr)
 {
-	buf_get(&ei_input, out_ptr, offset, length);
+	buf_get(&ei_input, out_ptr, signal_offset + offset, length);
 
 	return 0;
 }
 
+static void timing_add(const ei_impulse_result_t *result)
+{
+	ei_timing.dsp_time += result->timing.dsp;
+	ei_timing.classification_time += result->timing.classification;
+	ei_timing.anomaly_time += result->timing.anomaly;
+}
+
+#if CONFIG_EI_WRAPPER_INCREMENTAL
+static EI_IMPULSE_ERROR run_slice(signal_t *features_signal, size_t offset)
+{
+	signal_offset = offset;
+	features_signal->total_length = INPUT_SLICE_SIZE;
+
+	EI_IMPULSE_ERROR err = run_classifier_continuous(features_signal, &ei_result,
+							 DEBUG_MODE, false);
+
+	if (!err) {
+		timing_add(&ei_result);
+		ei_timing.dsp_input_size += INPUT_SLICE_SIZE;
+	}
+
+	return err;
+}
+
+static EI_IMPULSE_ERROR run_incremental(signal_t *features_signal)
+{
+	EI_IMPULSE_ERROR err = EI_IMPULSE_OK;
+
+	if (features_cached && (buf_get_last_move(&ei_input) == INPUT_SLICE_SIZE)) {
+		/* Only the last slice of the window is new. */
+		return run_slice(features_signal, INPUT_WINDOW_SIZE - INPUT_SLICE_SIZE);
+	}
+
+	/* Calculate features of the whole window. Classification result of the last
+	 * slice is the result for the window.
+	 */
+	run_classifier_init();
+
+	for (size_t i = 0; (i < SLICES_IN_WINDOW) && !err; i++) {
+		err = run_slice(features_signal, i * INPUT_SLICE_SIZE);
+	}
+
+	features_cached = !err;
+
+	return err;
+}
+#endif /* CONFIG_EI_WRAPPER_INCREMENTAL */
+
+static EI_IMPULSE_ERROR run(signal_t *features_signal)
+{
+	memset(&ei_timing, 0, sizeof(ei_timing));
+
+#if CONFIG_EI_WRAPPER_INCREMENTAL
+	return run_incremental(features_signal);
+#else
+	signal_offset = 0;
+	features_signal->total_length = INPUT_WINDOW_SIZE;
+
+	EI_IMPULSE_ERROR err = run_classifier(features_signal, &ei_result, DEBUG_MODE);
+
+	if (!err) {
+		timing_add(&ei_result);
+		ei_timing.dsp_input_size = INPUT_WINDOW_SIZE;
+	}
+
+	return err;
+#endif /* CONFIG_EI_WRAPPER_INCREMENTAL */
+}
+
 static void processing_finished(int err)
 {
 	__ASSERT_NO_MSG(user_cb);
@@ -320,34 +498,34 @@ static void processing_finished(int err)
 static void edge_impulse_thread_fn(void)
 {
 	signal_t features_signal;
-	int64_t start_time;
+	uint32_t start_cycles;
 
 	while (true) {
 		k_sem_take(&ei_sem, K_FOREVER);
 
 		features_signal.get_data = &raw_feature_get_data;
-		features_signal.total_length = INPUT_WINDOW_SIZE;
 
-		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
-			start_time = k_uptime_get();
-		}
+		start_cycles = k_cycle_get_32();
 
 		/* Invoke the impulse. */
-		EI_IMPULSE_ERROR err = run_classifier(&features_signal,
-						      &ei_result, DEBUG_MODE);
-		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
-			int64_t delta = k_uptime_delta(&start_time);
+		EI_IMPULSE_ERROR err = run(&features_signal);
 
-			LOG_INF("run_classifier execution time: %dms", (int32_t)delta);
-			LOG_INF("sampling: %dms dsp: %dms classification: %dms anomaly: %dms",
+		ei_timing.total_time_us = k_cyc_to_us_floor32(k_cycle_get_32() - start_cycles);
+
+		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
+			LOG_INF("run_classifier execution time: %uus", ei_timing.total_time_us);
+			LOG_INF("sampling: %dms dsp: %dms (%zu values) classification: %dms "
+				"anomaly: %dms",
 				ei_result.timing.sampling,
-				ei_result.timing.dsp,
-				ei_result.timing.classification,
-				ei_result.timing.anomaly);
+				ei_timing.dsp_time,
+				ei_timing.dsp_input_size,
+				ei_timing.classification_time,
+				ei_timing.anomaly_time);
 		}
 
 		if (err) {
 			LOG_ERR("run_classifier err=%d", (int)err);
+			features_cached = false;
 		}
 
 		processing_finished(err);
@@ -448,14 +626,14 @@ int ei_wrapper_get_timing(int *dsp_time, int *classification_time, int *anomaly_
 	}
 
 	if (dsp_time) {
-		*dsp_time = ei_result.timing.dsp;
+		*dsp_time = ei_timing.dsp_time;
 	}
 
 	if (classification_time) {
-		*classification_time = ei_result.timing.classification;
+		*classification_time = ei_timing.classification_time;
 	}
 
-	float anomaly_res = (HAS_ANOMALY) ? (ei_result.timing.anomaly) : (-1);
+	float anomaly_res = (HAS_ANOMALY) ? (ei_timing.anomaly_time) : (-1);
 
 	if (anomaly_time) {
 		*anomaly_time = anomaly_res;
@@ -464,6 +642,22 @@ int ei_wrapper_get_timing(int *dsp_time, int *classification_time, int *anomaly_
 	return 0;
 }
 
+int ei_wrapper_get_timing_details(struct ei_wrapper_timing *timing)
+{
+	if (!can_read_result()) {
+		LOG_WRN("Result can be read only from callback context");
+		return -EACCES;
+	}
+
+	*timing = ei_timing;
+
+	if (!HAS_ANOMALY) {
+		timing->anomaly_time = -1;
+	}
+
+	return 0;
+}
+
 int ei_wrapper_init(ei_wrapper_result_ready_cb cb)
 {
 	if (!cb) {
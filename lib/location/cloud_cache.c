@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <date_time.h>
+
+#include "cloud_cache.h"
+
+LOG_MODULE_DECLARE(location, CONFIG_LOCATION_LOG_LEVEL);
+
+#define SETTINGS_NAME "loc_cache"
+
+/* Serving cell, neighbor cells and access points */
+#define FINGERPRINT_ELEMS_MAX (1 + CONFIG_LOCATION_SERVICE_CLOUD_CACHE_NEIGHBORS + \
+			       CONFIG_LOCATION_SERVICE_CLOUD_CACHE_APS)
+
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME	 16777619U
+
+struct cloud_cache_fingerprint {
+	uint8_t count;
+	/** Hashes of the serving cell, strongest neighbor cells and strongest access points. */
+	uint32_t elems[FINGERPRINT_ELEMS_MAX];
+};
+
+/** Cache entry. This is stored as such into settings so changing it invalidates the cache. */
+struct cloud_cache_entry {
+	/** LRU stamp. Zero means that the entry is unused. */
+	uint32_t used;
+	/** Realtime clock in seconds when the location was received from the cloud. */
+	int64_t time;
+	double latitude;
+	double longitude;
+	float accuracy;
+	struct cloud_cache_fingerprint fingerprint;
+};
+
+static struct cloud_cache_entry cache[CONFIG_LOCATION_SERVICE_CLOUD_CACHE_SIZE];
+static uint32_t lru_stamp;
+static bool loaded;
+
+static K_MUTEX_DEFINE(cache_mutex);
+
+static int cloud_cache_settings_set(
+	const char *key, size_t len_rd, settings_read_cb read_cb, void *cb_arg);
+
+SETTINGS_STATIC_HANDLER_DEFINE(
+	location_cache, SETTINGS_NAME, NULL, cloud_cache_settings_set, NULL, NULL);
+
+static int cloud_cache_settings_set(
+	const char *key, size_t len_rd, settings_read_cb read_cb, void *cb_arg)
+{
+	struct cloud_cache_entry entry;
+	unsigned long index;
+	char *end;
+
+	if (!key) {
+		return -EINVAL;
+	}
+
+	index = strtoul(key, &end, 10);
+	if (end == key || *end != '\0' || index >= ARRAY_SIZE(cache) ||
+	    len_rd != sizeof(entry)) {
+		/* Entries from a different cache size or layout are ignored */
+		LOG_DBG("Ignoring cache entry %s with size %zu", key, len_rd);
+		return 0;
+	}
+
+	if (read_cb(cb_arg, &entry, len_rd) != len_rd) {
+		return -EIO;
+	}
+
+	cache[index] = entry;
+	lru_stamp = MAX(lru_stamp, entry.used);
+
+	return 0;
+}
+
+static void cloud_cache_load(void)
+{
+	int err;
+
+	if (loaded) {
+		return;
+	}
+
+	/* Cache is used without persistence if settings cannot be loaded */
+	loaded = true;
+
+	err = settings_subsys_init();
+	if (err) {
+		LOG_ERR("Failed to initialize settings, error: %d", err);
+		return;
+	}
+
+	err = settings_load_subtree(SETTINGS_NAME);
+	if (err) {
+		LOG_ERR("Failed to load location cache, error: %d", err);
+	}
+}
+
+static int cloud_cache_save(int index)
+{
+	char key[sizeof(SETTINGS_NAME) + 4];
+
+	snprintk(key, sizeof(key), SETTINGS_NAME "/%d", index);
+
+	return settings_save_one(key, &cache[index], sizeof(cache[index]));
+}
+
+static uint32_t hash_update(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *bytes = data;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ bytes[i]) * FNV_PRIME;
+	}
+
+	return hash;
+}
+
+static void fingerprint_add(struct cloud_cache_fingerprint *fingerprint, uint32_t hash)
+{
+	__ASSERT_NO_MSG(fingerprint->count < ARRAY_SIZE(fingerprint->elems));
+
+	fingerprint->elems[fingerprint->count++] = hash;
+}
+
+static void fingerprint_cells_add(
+	struct cloud_cache_fingerprint *fingerprint,
+	const struct lte_lc_cells_info *cell_data)
+{
+	const struct lte_lc_cell *cell = &cell_data->current_cell;
+	uint32_t picked = 0;
+	uint32_t hash;
+
+	if (cell->id == LTE_LC_CELL_EUTRAN_ID_INVALID) {
+		return;
+	}
+
+	hash = hash_update(FNV_OFFSET_BASIS, &cell->mcc, sizeof(cell->mcc));
+	hash = hash_update(hash, &cell->mnc, sizeof(cell->mnc));
+	hash = hash_update(hash, &cell->tac, sizeof(cell->tac));
+	hash = hash_update(hash, &cell->id, sizeof(cell->id));
+	fingerprint_add(fingerprint, hash);
+
+	/* Neighbor cells are identified by their frequency and physical cell ID.
+	 * Only the strongest ones are used because the weak ones come and go.
+	 */
+	for (int n = 0; n < CONFIG_LOCATION_SERVICE_CLOUD_CACHE_NEIGHBORS; n++) {
+		int strongest = -1;
+
+		for (int i = 0; i < MIN(cell_data->ncells_count, 32); i++) {
+			if ((picked & BIT(i)) == 0 && (strongest < 0 ||
+			    cell_data->neighbor_cells[i].rsrp >
+			    cell_data->neighbor_cells[strongest].rsrp)) {
+				strongest = i;
+			}
+		}
+		if (strongest < 0) {
+			break;
+		}
+		picked |= BIT(strongest);
+
+		hash = hash_update(FNV_OFFSET_BASIS,
+				   &cell_data->neighbor_cells[strongest].earfcn,
+				   sizeof(cell_data->neighbor_cells[strongest].earfcn));
+		hash = hash_update(hash,
+				   &cell_data->neighbor_cells[strongest].phys_cell_id,
+				   sizeof(cell_data->neighbor_cells[strongest].phys_cell_id));
+		fingerprint_add(fingerprint, hash);
+	}
+}
+
+static void fingerprint_aps_add(
+	struct cloud_cache_fingerprint *fingerprint,
+	const struct wifi_scan_info *wifi_data)
+{
+	uint32_t picked = 0;
+
+	for (int n = 0; n < CONFIG_LOCATION_SERVICE_CLOUD_CACHE_APS; n++) {
+		int strongest = -1;
+
+		for (int i = 0; i < MIN(wifi_data->cnt, 32); i++) {
+			if ((picked & BIT(i)) == 0 && (strongest < 0 ||
+			    wifi_data->ap_info[i].rssi > wifi_data->ap_info[strongest].rssi)) {
+				strongest = i;
+			}
+		}
+		if (strongest < 0) {
+			break;
+		}
+		picked |= BIT(strongest);
+
+		fingerprint_add(fingerprint,
+				hash_update(FNV_OFFSET_BASIS,
+					    wifi_data->ap_info[strongest].mac,
+					    sizeof(wifi_data->ap_info[strongest].mac)));
+	}
+}
+
+static void fingerprint_create(
+	struct cloud_cache_fingerprint *fingerprint,
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data)
+{
+	memset(fingerprint, 0, sizeof(*fingerprint));
+
+	if (cell_data != NULL) {
+		fingerprint_cells_add(fingerprint, cell_data);
+	}
+	if (wifi_data != NULL) {
+		fingerprint_aps_add(fingerprint, wifi_data);
+	}
+}
+
+/** Returns the overlap of the fingerprints as a percentage of their union. */
+static int fingerprint_overlap(
+	const struct cloud_cache_fingerprint *a,
+	const struct cloud_cache_fingerprint *b)
+{
+	int matches = 0;
+
+	if (a->count == 0 || b->count == 0) {
+		return 0;
+	}
+
+	for (int i = 0; i < a->count; i++) {
+		for (int j = 0; j < b->count; j++) {
+			if (a->elems[i] == b->elems[j]) {
+				matches++;
+				break;
+			}
+		}
+	}
+
+	return (100 * matches) / (a->count + b->count - matches);
+}
+
+/** Gets the current time in seconds. Fails if the date and time are not known yet. */
+static int cloud_cache_time_now(int64_t *now)
+{
+	int64_t now_ms;
+	int err;
+
+	err = date_time_now(&now_ms);
+	if (err) {
+		LOG_DBG("Date and time not valid, location cache not used");
+		return err;
+	}
+
+	*now = now_ms / MSEC_PER_SEC;
+
+	return 0;
+}
+
+/** Finds the entry with the largest overlap meeting the threshold, or returns -1. */
+static int cloud_cache_match_find(const struct cloud_cache_fingerprint *fingerprint, int64_t now)
+{
+	int best_index = -1;
+	int best_overlap = CONFIG_LOCATION_SERVICE_CLOUD_CACHE_THRESHOLD - 1;
+	int overlap;
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (cache[i].used == 0 ||
+		    now - cache[i].time > CONFIG_LOCATION_SERVICE_CLOUD_CACHE_MAX_AGE * 3600LL) {
+			continue;
+		}
+
+		overlap = fingerprint_overlap(fingerprint, &cache[i].fingerprint);
+		if (overlap > best_overlap) {
+			best_overlap = overlap;
+			best_index = i;
+		}
+	}
+
+	return best_index;
+}
+
+int cloud_cache_location_get(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	struct location_data *location)
+{
+	struct cloud_cache_fingerprint fingerprint;
+	int64_t now;
+	int64_t age;
+	int index;
+	int err;
+
+	/* Entry ages cannot be determined without a valid time */
+	err = cloud_cache_time_now(&now);
+	if (err) {
+		return err;
+	}
+
+	fingerprint_create(&fingerprint, cell_data, wifi_data);
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	cloud_cache_load();
+
+	index = cloud_cache_match_find(&fingerprint, now);
+	if (index < 0) {
+		k_mutex_unlock(&cache_mutex);
+		LOG_DBG("No matching location in cache");
+		return -ENOENT;
+	}
+
+	/* LRU stamp is only updated in RAM to avoid a flash write on every cache hit */
+	cache[index].used = ++lru_stamp;
+
+	age = MAX(now - cache[index].time, 0);
+	location->latitude = cache[index].latitude;
+	location->longitude = cache[index].longitude;
+	location->accuracy = cache[index].accuracy +
+		(float)CONFIG_LOCATION_SERVICE_CLOUD_CACHE_ACCURACY_AGING * age / 3600;
+
+	k_mutex_unlock(&cache_mutex);
+
+	LOG_DBG("Location found in cache entry %d, age %lld s", index, age);
+
+	return 0;
+}
+
+int cloud_cache_location_store(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	const struct location_data *location)
+{
+	struct cloud_cache_fingerprint fingerprint;
+	int64_t now;
+	int index;
+	int err;
+
+	fingerprint_create(&fingerprint, cell_data, wifi_data);
+	if (fingerprint.count == 0) {
+		return -EINVAL;
+	}
+
+	/* Entries stored without a valid time would never expire */
+	err = cloud_cache_time_now(&now);
+	if (err) {
+		return err;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	cloud_cache_load();
+
+	/* Refresh a matching entry, otherwise replace the least recently used one */
+	index = cloud_cache_match_find(&fingerprint, now);
+	if (index < 0) {
+		index = 0;
+		for (int i = 1; i < ARRAY_SIZE(cache); i++) {
+			if (cache[i].used < cache[index].used) {
+				index = i;
+			}
+		}
+	}
+
+	cache[index].used = ++lru_stamp;
+	cache[index].time = now;
+	cache[index].latitude = location->latitude;
+	cache[index].longitude = location->longitude;
+	cache[index].accuracy = location->accuracy;
+	cache[index].fingerprint = fingerprint;
+
+	err = cloud_cache_save(index);
+
+	k_mutex_unlock(&cache_mutex);
+
+	if (err) {
+		LOG_WRN("Failed to save location cache entry %d, error: %d", index, err);
+	} else {
+		LOG_DBG("Location stored into cache entry %d", index);
+	}
+
+	return err;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef CLOUD_CACHE_H_
+#define CLOUD_CACHE_H_
+
+#include <modem/location.h>
+#include <modem/lte_lc.h>
+#include <net/wifi_location_common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get a cached location for the given scan results.
+ *
+ * @details A fingerprint is formed from the serving cell, the strongest neighbor cells and
+ *          the strongest Wi-Fi access points. The cached location with the largest overlap
+ *          is returned if the overlap is above the configured threshold. The accuracy of the
+ *          returned location is degraded based on the age of the cached location.
+ *
+ * @param[in] cell_data Neighbor cell data. Can be NULL.
+ * @param[in] wifi_data Wi-Fi scanning results. Can be NULL.
+ * @param[out] location Storage for the cached location.
+ *
+ * @return 0 on cache hit, or negative error code otherwise.
+ * @retval -ENOENT No matching location in the cache.
+ * @retval -ENODATA Date and time are not valid yet, so the cache cannot be used.
+ */
+int cloud_cache_location_get(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	struct location_data *location);
+
+/**
+ * @brief Store a location received from the cloud for the given scan results.
+ *
+ * @details Replaces a matching cache entry or, if there is none, the least recently used one.
+ *          The entry is written to persistent storage. Nothing is stored while the date and
+ *          time are not valid.
+ *
+ * @param[in] cell_data Neighbor cell data. Can be NULL.
+ * @param[in] wifi_data Wi-Fi scanning results. Can be NULL.
+ * @param[in] location Location received from the cloud.
+ *
+ * @return 0 on success, or negative error code on failure.
+ */
+int cloud_cache_location_store(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	const struct location_data *location);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLOUD_CACHE_H_ */
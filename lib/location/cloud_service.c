@@ -13,6 +13,9 @@
 #endif
 
 #include "cloud_service.h"
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE)
+#include "cloud_cache.h"
+#endif
 
 LOG_MODULE_DECLARE(location, CONFIG_LOCATION_LOG_LEVEL);
 
@@ -126,6 +129,8 @@ int cloud_service_location_get(
 	const struct cloud_service_pos_req *params,
 	struct location_data *location)
 {
+	int err;
+
 	__ASSERT_NO_MSG(params != NULL);
 	__ASSERT_NO_MSG(params->cell_data != NULL || params->wifi_data != NULL);
 	__ASSERT_NO_MSG(location != NULL);
@@ -133,6 +138,21 @@ int cloud_service_location_get(
 	LOG_DBG("Cloud service location parameters:");
 	LOG_DBG("  Timeout: %dms", params->timeout_ms);
 
-	return cloud_service_pos_get(
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE)
+	if (cloud_cache_location_get(params->cell_data, params->wifi_data, location) == 0) {
+		LOG_INF("Using cached location, cloud request skipped");
+		return 0;
+	}
+#endif
+
+	err = cloud_service_pos_get(
 		params, recv_buf, sizeof(recv_buf), location);
+
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE)
+	if (!err) {
+		(void)cloud_cache_location_store(params->cell_data, params->wifi_data, location);
+	}
+#endif
+
+	return err;
 }
@@ -40,6 +40,17 @@ K_THREAD_STACK_DEFINE(location_core_stack, LOCATION_CORE_STACK_SIZE);
 /** Work queue for location library. Location methods can run their tasks in it. */
 static struct k_work_q location_core_work_q;
 
+#if defined(CONFIG_LOCATION_REQ_MODE_CONCURRENT)
+#define LOCATION_CORE_CLOUD_STACK_SIZE CONFIG_LOCATION_CLOUD_WORKQUEUE_STACK_SIZE
+K_THREAD_STACK_DEFINE(location_core_cloud_stack, LOCATION_CORE_CLOUD_STACK_SIZE);
+
+/**
+ * Work queue for cloud location method in concurrent mode. Scanning and the cloud request
+ * block the work queue for seconds, which would otherwise delay GNSS from starting.
+ */
+static struct k_work_q location_core_cloud_work_q;
+#endif
+
 /** Handler for periodic location requests. */
 static void location_core_periodic_work_fn(struct k_work *work);
 
@@ -67,6 +78,34 @@ K_WORK_DEFINE(location_event_cb_work, location_core_event_cb_fn);
 /** Semaphore protecting the use of location requests. */
 K_SEM_DEFINE(location_core_sem, 1, 1);
 
+/** State of a location request in LOCATION_REQ_MODE_CONCURRENT. */
+struct location_concurrent_info {
+	struct k_spinlock lock;
+
+	/** Bitmask of methods that have been started but have not reported a result yet. */
+	uint32_t pending;
+
+	/** Whether the result of the request has been decided. */
+	bool decided;
+
+	/** Cloud location method in the method list, zero if there is none. */
+	enum location_method cloud_method;
+
+	/** Whether the best location not meeting the accuracy target is stored. */
+	bool best_valid;
+	enum location_method best_method;
+	struct location_data best;
+
+	/** Latest failure, reported if none of the methods acquire a location. */
+	enum location_method failed_method;
+	enum location_event_id failed_id;
+
+	/** Uptime when the methods were started, for time-to-fix measurement. */
+	int64_t start_uptime;
+};
+
+static struct location_concurrent_info concurrent;
+
 /***** Location method configurations *****/
 
 #if defined(CONFIG_LOCATION_METHOD_GNSS)
@@ -240,12 +279,26 @@ int location_core_init(void)
 		LOCATION_CORE_PRIORITY,
 		&cfg);
 
+#if defined(CONFIG_LOCATION_REQ_MODE_CONCURRENT)
+	struct k_work_queue_config cloud_cfg = {
+		.name = "location_cloud_workq",
+	};
+
+	k_work_queue_start(
+		&location_core_cloud_work_q,
+		location_core_cloud_stack,
+		K_THREAD_STACK_SIZEOF(location_core_cloud_stack),
+		LOCATION_CORE_PRIORITY,
+		&cloud_cfg);
+#endif
+
 	return 0;
 }
 
 int location_core_validate_params(const struct location_config *config)
 {
 	const struct location_method_api *method_api;
+	uint32_t methods_used = 0;
 
 	__ASSERT_NO_MSG(config != NULL);
 
@@ -267,6 +320,27 @@ int location_core_validate_params(const struct location_config *config)
 			return -EINVAL;
 		}
 	}
+
+	if (config->mode == LOCATION_REQ_MODE_CONCURRENT) {
+		if (!IS_ENABLED(CONFIG_LOCATION_REQ_MODE_CONCURRENT)) {
+			LOG_ERR("LOCATION_REQ_MODE_CONCURRENT requires "
+				"CONFIG_LOCATION_REQ_MODE_CONCURRENT");
+			return -EINVAL;
+		}
+		if (config->accuracy_target < 0.0f) {
+			LOG_ERR("Accuracy target cannot be negative");
+			return -EINVAL;
+		}
+		/* Results are tracked per method so each method can be given only once */
+		for (int i = 0; i < config->methods_count; i++) {
+			if (methods_used & BIT(config->methods[i].method)) {
+				LOG_ERR("Location method (%d) given more than once",
+					config->methods[i].method);
+				return -EINVAL;
+			}
+			methods_used |= BIT(config->methods[i].method);
+		}
+	}
 	return 0;
 }
 
@@ -282,6 +356,9 @@ void location_core_config_log(const struct location_config *config)
 	LOG_DBG("  Interval: %d", config->interval);
 	LOG_DBG("  Timeout: %dms", config->timeout);
 	LOG_DBG("  Mode: %d", config->mode);
+	if (config->mode == LOCATION_REQ_MODE_CONCURRENT) {
+		LOG_DBG("  Accuracy target: %dm", (int)config->accuracy_target);
+	}
 	LOG_DBG("  List of methods:");
 
 	for (uint8_t i = 0; i < config->methods_count; i++) {
@@ -325,6 +402,222 @@ static void location_core_current_config_set(const struct location_config *confi
 	memcpy(&loc_req_info.config, config, sizeof(loc_req_info.config));
 }
 
+static bool location_core_is_concurrent(void)
+{
+	return IS_ENABLED(CONFIG_LOCATION_REQ_MODE_CONCURRENT) &&
+	       loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT;
+}
+
+static bool location_core_is_cloud_method(int method)
+{
+	if (method == LOCATION_METHOD_CELLULAR ||
+	    method == LOCATION_METHOD_WIFI ||
+	    method == LOCATION_METHOD_WIFI_CELLULAR) {
+		return true;
+	}
+
+	return false;
+}
+
+static void location_core_started_event_dispatch(enum location_method method)
+{
+	if (IS_ENABLED(CONFIG_LOCATION_DATA_DETAILS)) {
+		struct location_event_data request_started = {
+			.id = LOCATION_EVT_STARTED,
+			.method = method
+		};
+
+		location_utils_event_dispatch(&request_started);
+	}
+}
+
+/**
+ * Sets the result of a concurrent location request and schedules the event callback.
+ * Must only be called by the context that set concurrent.decided.
+ */
+static void location_core_concurrent_decide(
+	enum location_method method,
+	enum location_event_id id,
+	const struct location_data *location)
+{
+	loc_req_info.current_method = method;
+	loc_req_info.current_event_data.id = id;
+	if (id == LOCATION_EVT_LOCATION) {
+		loc_req_info.current_event_data.location = *location;
+	}
+	loc_req_info.execute_fallback = false;
+
+	/* All methods were started together, so the elapsed time in the details of the event is
+	 * the time to fix of the whole request.
+	 */
+	loc_req_info.elapsed_time_method_start_timestamp = concurrent.start_uptime;
+
+	LOG_INF("LOCATION_REQ_MODE_CONCURRENT: result from '%s' after %lld ms",
+		(char *)location_method_api_get(method)->method_string,
+		k_uptime_get() - concurrent.start_uptime);
+
+	k_work_submit_to_queue(location_core_work_queue_get(), &location_event_cb_work);
+}
+
+/** Handles the result of one of the methods in LOCATION_REQ_MODE_CONCURRENT. */
+static void location_core_concurrent_result(
+	enum location_method method,
+	enum location_event_id id,
+	const struct location_data *location)
+{
+	enum location_method result_method = method;
+	enum location_event_id result_id = id;
+	const struct location_data *result_location = location;
+	int64_t time_to_fix = k_uptime_get() - concurrent.start_uptime;
+	bool decided = false;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&concurrent.lock);
+
+	if (concurrent.decided || (concurrent.pending & BIT(method)) == 0) {
+		k_spin_unlock(&concurrent.lock, key);
+		LOG_DBG("Ignoring event %d from '%s' method", id,
+			(char *)location_method_api_get(method)->method_string);
+		return;
+	}
+	concurrent.pending &= ~BIT(method);
+
+	if (id == LOCATION_EVT_LOCATION) {
+		if (loc_req_info.config.accuracy_target <= 0.0f ||
+		    location->accuracy <= loc_req_info.config.accuracy_target) {
+			decided = true;
+		} else if (!concurrent.best_valid ||
+			   location->accuracy < concurrent.best.accuracy) {
+			concurrent.best = *location;
+			concurrent.best_method = method;
+			concurrent.best_valid = true;
+		}
+	} else {
+		concurrent.failed_method = method;
+		concurrent.failed_id = id;
+	}
+
+	if (!decided && concurrent.pending == 0) {
+		/* All methods have completed without meeting the accuracy target */
+		decided = true;
+		if (concurrent.best_valid) {
+			result_method = concurrent.best_method;
+			result_id = LOCATION_EVT_LOCATION;
+			result_location = &concurrent.best;
+		} else {
+			result_method = concurrent.failed_method;
+			result_id = concurrent.failed_id;
+		}
+	}
+	concurrent.decided = decided;
+
+	k_spin_unlock(&concurrent.lock, key);
+
+	LOG_INF("'%s' method completed with event %d after %lld ms",
+		(char *)location_method_api_get(method)->method_string, id, time_to_fix);
+
+	if (decided) {
+		location_core_concurrent_decide(result_method, result_id, result_location);
+	}
+}
+
+/** Cancels, or times out, the methods that have not reported a result yet. */
+static void location_core_concurrent_pending_stop(bool timeout)
+{
+	const struct location_method_api *method_api;
+	k_spinlock_key_t key;
+	uint32_t pending;
+
+	key = k_spin_lock(&concurrent.lock);
+	pending = concurrent.pending;
+	concurrent.pending = 0;
+	k_spin_unlock(&concurrent.lock, key);
+
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		if ((pending & BIT(loc_req_info.methods[i])) == 0) {
+			continue;
+		}
+		method_api = location_method_api_get(loc_req_info.methods[i]);
+
+		LOG_DBG("Stopping '%s' method", (char *)method_api->method_string);
+		if (timeout) {
+			(void)method_api->timeout();
+		} else {
+			(void)method_api->cancel();
+		}
+	}
+}
+
+static void location_core_concurrent_timeout(void)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&concurrent.lock);
+	if (concurrent.decided) {
+		k_spin_unlock(&concurrent.lock, key);
+		return;
+	}
+	concurrent.decided = true;
+	k_spin_unlock(&concurrent.lock, key);
+
+	location_core_concurrent_pending_stop(true);
+
+	/* Return the best location so far even if it doesn't meet the accuracy target */
+	if (concurrent.best_valid) {
+		location_core_concurrent_decide(
+			concurrent.best_method, LOCATION_EVT_LOCATION, &concurrent.best);
+	} else {
+		location_core_concurrent_decide(
+			loc_req_info.methods[0], LOCATION_EVT_TIMEOUT, NULL);
+	}
+}
+
+static void location_core_concurrent_start(void)
+{
+	enum location_method requested_method;
+	k_spinlock_key_t key;
+	int err;
+
+	/* All methods are marked pending before starting any of them so that a quick failure
+	 * of the first method is not taken as the final result.
+	 */
+	key = k_spin_lock(&concurrent.lock);
+	concurrent.pending = 0;
+	concurrent.decided = false;
+	concurrent.cloud_method = 0;
+	concurrent.best_valid = false;
+	concurrent.failed_method = loc_req_info.methods[0];
+	concurrent.failed_id = LOCATION_EVT_ERROR;
+	concurrent.start_uptime = k_uptime_get();
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		concurrent.pending |= BIT(loc_req_info.methods[i]);
+		if (location_core_is_cloud_method(loc_req_info.methods[i])) {
+			concurrent.cloud_method = loc_req_info.methods[i];
+		}
+	}
+	k_spin_unlock(&concurrent.lock, key);
+
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		requested_method = loc_req_info.methods[i];
+		LOG_DBG("LOCATION_REQ_MODE_CONCURRENT: starting '%s' method",
+			(char *)location_method_api_get(requested_method)->method_string);
+
+		/* Methods read the current method from the request information when starting */
+		location_core_current_event_data_init(requested_method);
+
+		err = location_method_api_get(requested_method)->location_get(&loc_req_info);
+		if (err) {
+			LOG_ERR("Failed to start '%s' method, error: %d",
+				(char *)location_method_api_get(requested_method)->method_string,
+				err);
+			location_core_concurrent_result(requested_method, LOCATION_EVT_ERROR, NULL);
+			continue;
+		}
+
+		location_core_started_event_dispatch(requested_method);
+	}
+}
+
 static int location_core_location_get_pos(void)
 {
 	int err;
@@ -336,23 +629,22 @@ static int location_core_location_get_pos(void)
 		k_uptime_get() + loc_req_info.config.timeout : SYS_FOREVER_MS;
 	loc_req_info.execute_fallback = true;
 	loc_req_info.current_method_index = 0;
-	requested_method = loc_req_info.methods[loc_req_info.current_method_index];
-	LOG_DBG("Requesting location with '%s' method",
-		(char *)location_method_api_get(requested_method)->method_string);
-	location_core_current_event_data_init(requested_method);
 
-	err = location_method_api_get(requested_method)->location_get(&loc_req_info);
-	if (err != 0) {
-		return err;
-	}
+	if (location_core_is_concurrent()) {
+		/* Failures to start are reported through events like other method failures */
+		location_core_concurrent_start();
+	} else {
+		requested_method = loc_req_info.methods[loc_req_info.current_method_index];
+		LOG_DBG("Requesting location with '%s' method",
+			(char *)location_method_api_get(requested_method)->method_string);
+		location_core_current_event_data_init(requested_method);
 
-	if (IS_ENABLED(CONFIG_LOCATION_DATA_DETAILS)) {
-		struct location_event_data request_started = {
-			.id = LOCATION_EVT_STARTED,
-			.method = requested_method
-		};
+		err = location_method_api_get(requested_method)->location_get(&loc_req_info);
+		if (err != 0) {
+			return err;
+		}
 
-		location_utils_event_dispatch(&request_started);
+		location_core_started_event_dispatch(requested_method);
 	}
 
 	if (loc_req_info.config.timeout != SYS_FOREVER_MS &&
@@ -403,6 +695,9 @@ static void location_request_info_create(const struct location_config *config)
 			LOG_DBG("Wi-Fi and cellular methods are not one after the other "
 				"in method list so they are not combined");
 		}
+	} else if (location_core_is_concurrent()) {
+		/* Wi-Fi and cellular are always combined into one cloud request in concurrent mode */
+		combine_wifi_cell = loc_req_info.cellular != NULL && loc_req_info.wifi != NULL;
 	}
 
 	/* Compose a list of methods that are really used, including combined internal method */
@@ -463,6 +758,12 @@ int location_core_location_get(const struct location_config *config)
 
 void location_core_event_cb_error(void)
 {
+	if (location_core_is_concurrent()) {
+		/* Only GNSS uses the generic callbacks in concurrent mode */
+		location_core_concurrent_result(LOCATION_METHOD_GNSS, LOCATION_EVT_ERROR, NULL);
+		return;
+	}
+
 	loc_req_info.current_event_data.id = LOCATION_EVT_ERROR;
 
 	location_core_event_cb(NULL);
@@ -470,6 +771,11 @@ void location_core_event_cb_error(void)
 
 void location_core_event_cb_timeout(void)
 {
+	if (location_core_is_concurrent()) {
+		location_core_concurrent_result(LOCATION_METHOD_GNSS, LOCATION_EVT_TIMEOUT, NULL);
+		return;
+	}
+
 	loc_req_info.current_event_data.id = LOCATION_EVT_TIMEOUT;
 
 	location_core_event_cb(NULL);
@@ -534,23 +840,15 @@ void location_core_event_cb_cloud_location_request(struct location_data_cloud *r
 	location_utils_event_dispatch(&cloud_location_request_event_data);
 }
 
-static bool location_core_is_cloud_method(int method)
-{
-	if (method == LOCATION_METHOD_CELLULAR ||
-	    method == LOCATION_METHOD_WIFI ||
-	    method == LOCATION_METHOD_WIFI_CELLULAR) {
-		return true;
-	}
-
-	return false;
-}
-
 void location_core_cloud_location_ext_result_set(
 	enum location_ext_result result,
 	struct location_data *location)
 {
+	enum location_event_id id;
+
 	if (k_sem_count_get(&location_core_sem) > 0 ||
-	    !location_core_is_cloud_method(loc_req_info.current_method)) {
+	    (!location_core_is_concurrent() &&
+	     !location_core_is_cloud_method(loc_req_info.current_method))) {
 		LOG_WRN("Cloud positioning result set called but no "
 			"cloud location request pending");
 		return;
@@ -562,18 +860,27 @@ void location_core_cloud_location_ext_result_set(
 
 	switch (result) {
 	case LOCATION_EXT_RESULT_SUCCESS:
-		loc_req_info.current_event_data.id = LOCATION_EVT_LOCATION;
-		loc_req_info.current_event_data.location = *location;
+		id = LOCATION_EVT_LOCATION;
 		break;
 	case LOCATION_EXT_RESULT_UNKNOWN:
-		loc_req_info.current_event_data.id = LOCATION_EVT_RESULT_UNKNOWN;
+		id = LOCATION_EVT_RESULT_UNKNOWN;
 		break;
 	case LOCATION_EXT_RESULT_ERROR:
 	default:
-		loc_req_info.current_event_data.id = LOCATION_EVT_ERROR;
+		id = LOCATION_EVT_ERROR;
 		break;
 	}
 
+	if (location_core_is_concurrent()) {
+		location_core_concurrent_result(concurrent.cloud_method, id, location);
+		return;
+	}
+
+	loc_req_info.current_event_data.id = id;
+	if (id == LOCATION_EVT_LOCATION) {
+		loc_req_info.current_event_data.location = *location;
+	}
+
 	k_work_submit_to_queue(
 		location_core_work_queue_get(),
 		&location_event_cb_work);
@@ -610,6 +917,10 @@ static void location_core_event_cb_fn(struct k_work *work)
 	int err;
 
 	k_work_cancel_delayable(&location_core_method_timeout_work);
+	if (location_core_is_concurrent()) {
+		/* Result is decided so the methods still running are not needed */
+		location_core_concurrent_pending_stop(false);
+	}
 	loc_req_info.current_event_data.method = loc_req_info.current_method;
 
 	/* Update the event structure with the details of the current method */
@@ -744,6 +1055,14 @@ static void location_core_event_cb_fn(struct k_work *work)
 
 void location_core_event_cb(const struct location_data *location)
 {
+	if (location_core_is_concurrent()) {
+		location_core_concurrent_result(
+			LOCATION_METHOD_GNSS,
+			location ? LOCATION_EVT_LOCATION : LOCATION_EVT_ERROR,
+			location);
+		return;
+	}
+
 	if (location) {
 		loc_req_info.current_event_data.id = LOCATION_EVT_LOCATION;
 		loc_req_info.current_event_data.location = *location;
@@ -760,11 +1079,34 @@ void location_core_event_cb(const struct location_data *location)
 	}
 }
 
+void location_core_cloud_event_cb(enum location_event_id id, const struct location_data *location)
+{
+	if (location_core_is_concurrent()) {
+		location_core_concurrent_result(concurrent.cloud_method, id, location);
+		return;
+	}
+
+	if (id != LOCATION_EVT_LOCATION) {
+		loc_req_info.current_event_data.id = id;
+	}
+	location_core_event_cb(location);
+}
+
 struct k_work_q *location_core_work_queue_get(void)
 {
 	return &location_core_work_q;
 }
 
+struct k_work_q *location_core_cloud_work_queue_get(void)
+{
+#if defined(CONFIG_LOCATION_REQ_MODE_CONCURRENT)
+	if (location_core_is_concurrent()) {
+		return &location_core_cloud_work_q;
+	}
+#endif
+	return &location_core_work_q;
+}
+
 static void location_core_periodic_work_fn(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -778,6 +1120,14 @@ static void location_core_method_timeout_work_fn(struct k_work *work)
 
 	ARG_UNUSED(work);
 
+	if (location_core_is_concurrent()) {
+		/* GNSS is the only method using the method specific timer */
+		LOG_INF("GNSS timeout expired");
+		location_method_api_get(LOCATION_METHOD_GNSS)->timeout();
+		location_core_concurrent_result(LOCATION_METHOD_GNSS, LOCATION_EVT_TIMEOUT, NULL);
+		return;
+	}
+
 	LOG_INF("Method specific timeout expired");
 
 	location_method_api_get(current_method)->timeout();
@@ -793,6 +1143,11 @@ static void location_core_timeout_work_fn(struct k_work *work)
 
 	LOG_INF("Timeout for entire location request expired");
 
+	if (location_core_is_concurrent()) {
+		location_core_concurrent_timeout();
+		return;
+	}
+
 	location_method_api_get(current_method)->timeout();
 	/* config->timeout needs to expire without fallbacks */
 
@@ -830,9 +1185,19 @@ int location_core_cancel(void)
 
 	/* Check if location has been requested using one of the methods */
 	if (current_method != 0) {
-		LOG_DBG("Cancelling location method for '%s' method",
-			(char *)location_method_api_get(current_method)->method_string);
-		err = location_method_api_get(current_method)->cancel();
+		if (location_core_is_concurrent()) {
+			k_spinlock_key_t key = k_spin_lock(&concurrent.lock);
+
+			concurrent.decided = true;
+			k_spin_unlock(&concurrent.lock, key);
+
+			LOG_DBG("Cancelling all location methods");
+			location_core_concurrent_pending_stop(false);
+		} else {
+			LOG_DBG("Cancelling location method for '%s' method",
+				(char *)location_method_api_get(current_method)->method_string);
+			err = location_method_api_get(current_method)->cancel();
+		}
 
 		/* -EPERM means method wasn't running and this is converted to no error.
 		 * This is normal in periodic mode.
@@ -66,6 +66,7 @@ int location_core_cancel(void);
 void location_core_event_cb(const struct location_data *location);
 void location_core_event_cb_error(void);
 void location_core_event_cb_timeout(void);
+void location_core_cloud_event_cb(enum location_event_id id, const struct location_data *location);
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) && defined(CONFIG_NRF_CLOUD_AGNSS)
 void location_core_event_cb_agnss_request(const struct nrf_modem_gnss_agnss_data_frame *request);
 #endif
@@ -83,5 +84,6 @@ void location_core_cloud_location_ext_result_set(
 void location_core_config_log(const struct location_config *config);
 void location_core_timer_start(int32_t timeout);
 struct k_work_q *location_core_work_queue_get(void);
+struct k_work_q *location_core_cloud_work_queue_get(void);
 
 #endif /* LOCATION_CORE_H */
@@ -146,16 +146,16 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 		location_result.latitude = location.latitude;
 		location_result.longitude = location.longitude;
 		location_result.accuracy = location.accuracy;
-		location_core_event_cb(&location_result);
+		location_core_cloud_event_cb(LOCATION_EVT_LOCATION, &location_result);
 	}
 
 #endif /* defined(CONFIG_LOCATION_SERVICE_EXTERNAL) */
 
 end:
 	if (err == -ETIMEDOUT) {
-		location_core_event_cb_timeout();
+		location_core_cloud_event_cb(LOCATION_EVT_TIMEOUT, NULL);
 	} else if (err) {
-		location_core_event_cb_error();
+		location_core_cloud_event_cb(LOCATION_EVT_ERROR, NULL);
 	}
 	running = false;
 }
@@ -200,7 +200,7 @@ int method_cloud_location_get(const struct location_request_info *request)
 
 	method_cloud_location_start_work.locreq_timeout_uptime = request->timeout_uptime;
 	k_work_submit_to_queue(
-		location_core_work_queue_get(),
+		location_core_cloud_work_queue_get(),
 		&method_cloud_location_start_work.work_item);
 
 	running = true;
@@ -240,6 +240,50 @@ static bool checkContext(otCryptoContext *aContext, size_t aMinSize)
 	return aContext != NULL && aContext->mContext != NULL && aContext->mContextSize >= aMinSize;
 }
 
+#if defined(CONFIG_OPENTHREAD_PSA_AES_MULTIPART)
+/*
+ * OpenThread computes AES-CCM in software, calling otPlatCryptoAesEncrypt() for each block of a
+ * frame. The AES context provided by OpenThread only fits a key reference, so a single ECB
+ * operation is kept set up for the most recently used key. Every block is then processed with one
+ * cipher update instead of a key lookup and a driver setup. Calls are serialized by the
+ * OpenThread API lock.
+ */
+static psa_cipher_operation_t aes_operation;
+static psa_key_id_t aes_operation_key;
+
+static void aesOperationReset(void)
+{
+	psa_cipher_abort(&aes_operation);
+	aes_operation_key = (psa_key_id_t)0;
+}
+
+static psa_status_t aesOperationEncrypt(psa_key_id_t aKeyRef, const uint8_t *aInput,
+					uint8_t *aOutput, size_t aLength)
+{
+	psa_status_t status;
+	size_t cipher_length;
+
+	if (aes_operation_key != aKeyRef || aKeyRef == (psa_key_id_t)0) {
+		aesOperationReset();
+
+		status = psa_cipher_encrypt_setup(&aes_operation, aKeyRef, PSA_ALG_ECB_NO_PADDING);
+		if (status != PSA_SUCCESS) {
+			return status;
+		}
+
+		aes_operation_key = aKeyRef;
+	}
+
+	status = psa_cipher_update(&aes_operation, aInput, aLength, aOutput, aLength,
+				   &cipher_length);
+	if (status != PSA_SUCCESS) {
+		aesOperationReset();
+	}
+
+	return status;
+}
+#endif /* CONFIG_OPENTHREAD_PSA_AES_MULTIPART */
+
 void otPlatCryptoInit(void)
 {
 	psa_crypto_init();
@@ -274,6 +318,11 @@ otError otPlatCryptoImportKey(otCryptoKeyRef *aKeyRef, otCryptoKeyType aKeyType,
 		return OT_ERROR_INVALID_ARGS;
 	}
 
+#if defined(CONFIG_OPENTHREAD_PSA_AES_MULTIPART)
+	/* A persistent key may be re-imported under the same reference */
+	aesOperationReset();
+#endif
+
 #if defined(CONFIG_OPENTHREAD_ECDSA)
 	/* Check if key is ECDSA pair and extract private key from it since PSA expects it. */
 	if (aKeyType == OT_CRYPTO_KEY_TYPE_ECDSA) {
@@ -350,6 +399,13 @@ otError otPlatCryptoDestroyKey(otCryptoKeyRef aKeyRef)
 {
 	GET_KEY_REF(&aKeyRef, NULL);
 
+#if defined(CONFIG_OPENTHREAD_PSA_AES_MULTIPART)
+	/* The reference of a destroyed volatile key can be reused for a new key */
+	if (aKeyRef == aes_operation_key) {
+		aesOperationReset();
+	}
+#endif
+
 	return psaToOtError(psa_destroy_key(aKeyRef));
 }
 
@@ -473,7 +529,9 @@ otError otPlatCryptoAesEncrypt(otCryptoContext *aContext, const uint8_t *aInput,
 	const size_t block_size = PSA_BLOCK_CIPHER_BLOCK_LENGTH(PSA_KEY_TYPE_AES);
 	psa_status_t status = PSA_SUCCESS;
 	psa_key_id_t key_ref;
+#if !defined(CONFIG_OPENTHREAD_PSA_AES_MULTIPART)
 	size_t cipher_length;
+#endif
 
 	if (aInput == NULL || aOutput == NULL || !checkContext(aContext, sizeof(psa_key_id_t))) {
 		return OT_ERROR_INVALID_ARGS;
@@ -483,14 +541,23 @@ otError otPlatCryptoAesEncrypt(otCryptoContext *aContext, const uint8_t *aInput,
 
 	GET_KEY_REF(&key_ref, NULL);
 
+#if defined(CONFIG_OPENTHREAD_PSA_AES_MULTIPART)
+	status = aesOperationEncrypt(key_ref, aInput, aOutput, block_size);
+#else
 	status = psa_cipher_encrypt(key_ref, PSA_ALG_ECB_NO_PADDING, aInput, block_size, aOutput,
 				    block_size, &cipher_length);
+#endif
 
 	return psaToOtError(status);
 }
 
 otError otPlatCryptoAesFree(otCryptoContext *aContext)
 {
+#if defined(CONFIG_OPENTHREAD_PSA_AES_MULTIPART)
+	/* Do not keep the key material in the driver context once the frame is processed */
+	aesOperationReset();
+#endif
+
 	return OT_ERROR_NONE;
 }
 
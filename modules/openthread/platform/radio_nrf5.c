@@ -171,6 +171,9 @@ struct nrf5_rx_frame {
 	int8_t rssi;	     /* Last received frame RSSI value. */
 	bool ack_fpb;	     /* FPB value in ACK sent for the received frame. */
 	bool ack_seb;	     /* SEB value in ACK sent for the received frame. */
+#if defined(CONFIG_NRF5_RX_STATS)
+	uint32_t cycles;     /* Cycle count when the frame was handed over by the driver. */
+#endif
 };
 
 /** Energy detection callback */
@@ -220,6 +223,11 @@ struct nrf5_data {
 
 		/* RX result, updated in radio transmit callbacks. */
 		otError result;
+
+#if defined(CONFIG_NRF5_RX_STATS)
+		/* Statistics of frame delivery to the OpenThread stack. */
+		struct openthread_platform_radio_rx_stats stats;
+#endif
 	} rx;
 
 	struct {
@@ -293,8 +301,13 @@ static inline bool is_pending_event_set(enum nrf5_pending_events event)
 
 static void set_pending_event(enum nrf5_pending_events event)
 {
-	atomic_set_bit(nrf5_data.pending_events, event);
-	otSysEventSignalPending();
+	/* An event that is already pending has signaled the OpenThread thread and is handled, along
+	 * with everything queued since, in the next platformRadioProcess() call. Signal only the
+	 * first occurrence so that a burst of received frames wakes the thread once.
+	 */
+	if (!atomic_test_and_set_bit(nrf5_data.pending_events, event)) {
+		otSysEventSignalPending();
+	}
 }
 
 static void reset_pending_event(enum nrf5_pending_events event)
@@ -773,14 +786,60 @@ static bool nrf5_tx_at(otRadioFrame *frame, uint8_t *payload)
 	return result == NRF_802154_TX_ERROR_NONE;
 }
 
+#if defined(CONFIG_NRF5_RX_STATS)
+static void rx_stats_frame_update(const struct nrf5_rx_frame *rx_frame)
+{
+	struct openthread_platform_radio_rx_stats *stats = &nrf5_data.rx.stats;
+	uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - rx_frame->cycles);
+
+	stats->frames++;
+	stats->latency_sum_us += latency_us;
+	stats->latency_max_us = MAX(stats->latency_max_us, latency_us);
+}
+
+static void rx_stats_batch_update(uint32_t batch)
+{
+	struct openthread_platform_radio_rx_stats *stats = &nrf5_data.rx.stats;
+
+	if (batch == 0) {
+		return;
+	}
+
+	stats->batches++;
+	stats->batch_max = MAX(stats->batch_max, batch);
+}
+
+void openthread_platform_radio_rx_stats_get(struct openthread_platform_radio_rx_stats *stats)
+{
+	*stats = nrf5_data.rx.stats;
+}
+
+void openthread_platform_radio_rx_stats_reset(void)
+{
+	memset(&nrf5_data.rx.stats, 0, sizeof(nrf5_data.rx.stats));
+}
+#endif /* CONFIG_NRF5_RX_STATS */
+
 static void handle_frame_received(otInstance *aInstance)
 {
 	struct nrf5_rx_frame *rx_frame;
+	uint32_t batch = 0;
 
+	/* Deliver all frames queued since the last wake-up */
 	while ((rx_frame = (struct nrf5_rx_frame *)k_fifo_get(&nrf5_data.rx.fifo, K_NO_WAIT)) !=
 	       NULL) {
+#if defined(CONFIG_NRF5_RX_STATS)
+		rx_stats_frame_update(rx_frame);
+#endif
 		openthread_handle_received_frame(aInstance, rx_frame);
+		batch++;
 	}
+
+#if defined(CONFIG_NRF5_RX_STATS)
+	rx_stats_batch_update(batch);
+#else
+	ARG_UNUSED(batch);
+#endif
 }
 
 static void handle_rx_failed(otInstance *aInstance)
@@ -1839,6 +1898,10 @@ static void openthread_nrf_802154_received_timestamp_raw(uint8_t *data, int8_t p
 		nrf5_data.rx.last_frame_ack_fpb = false;
 		nrf5_data.rx.last_frame_ack_seb = false;
 
+#if defined(CONFIG_NRF5_RX_STATS)
+		nrf5_data.rx.frames[i].cycles = k_cycle_get_32();
+#endif
+
 		k_fifo_put(&nrf5_data.rx.fifo, &nrf5_data.rx.frames[i]);
 		set_pending_event(PENDING_EVENT_FRAME_RECEIVED);
 
@@ -13,4 +13,35 @@
 
 void openthread_platform_radio_set_eui64(uint8_t eui64[EXTENDED_ADDRESS_SIZE]);
 
+/** Statistics of received frame delivery to the OpenThread stack. */
+struct openthread_platform_radio_rx_stats {
+	/** Number of wake-ups of the OpenThread thread that delivered received frames. */
+	uint32_t batches;
+	/** Number of delivered frames. */
+	uint32_t frames;
+	/** Largest number of frames delivered in one wake-up. */
+	uint32_t batch_max;
+	/** Longest time from the radio driver callback to the delivery of a frame. */
+	uint32_t latency_max_us;
+	/** Sum of the times from the radio driver callback to the delivery of a frame. */
+	uint64_t latency_sum_us;
+};
+
+/**
+ * @brief Get the statistics of received frame delivery.
+ *
+ * Available if the CONFIG_NRF5_RX_STATS Kconfig option is enabled. Call it from the OpenThread
+ * thread, or with the OpenThread API lock held.
+ *
+ * @param[out] stats Statistics.
+ */
+void openthread_platform_radio_rx_stats_get(struct openthread_platform_radio_rx_stats *stats);
+
+/**
+ * @brief Reset the statistics of received frame delivery.
+ *
+ * Available if the CONFIG_NRF5_RX_STATS Kconfig option is enabled.
+ */
+void openthread_platform_radio_rx_stats_reset(void);
+
 #endif /* OT_PLATFORM_RADIO_NRF5_Hz */
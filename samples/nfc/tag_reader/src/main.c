@@ -40,7 +40,8 @@
 
 #define NFC_NDEF_REC_PARSER_BUFF_SIZE 128
 
-#define NFC_TX_DATA_LEN NFC_T4T_ISODEP_FSD
+/* Room for two frames to prepare the next chained I-block while one is sent. */
+#define NFC_TX_DATA_LEN (2 * NFC_T4T_ISODEP_FSD)
 #define NFC_RX_DATA_LEN NFC_T4T_ISODEP_FSD
 
 #define T2T_MAX_DATA_EXCHANGE 16
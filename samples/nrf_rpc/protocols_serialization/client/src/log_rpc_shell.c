@@ -17,6 +17,9 @@
 #define COREDUMP_LOG_END      "END#"
 #define COREDUMP_LOG_LINE_LEN 32
 
+#define BENCH_DRAIN_TIMEOUT_MS 1000
+#define BENCH_POLL_INTERVAL_MS 10
+
 static int cmd_log_rpc_stream_level(const struct shell *sh, size_t argc, char *argv[])
 {
 	int rc = 0;
@@ -226,6 +229,62 @@ static int cmd_log_rpc_echo(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+static int cmd_log_rpc_bench(const struct shell *sh, size_t argc, char *argv[])
+{
+	int rc = 0;
+	uint32_t count;
+	int64_t start;
+	int64_t elapsed;
+	int64_t last_progress;
+	uint32_t last_messages = 0;
+	struct log_rpc_stream_stats stats;
+
+	count = shell_strtoul(argv[1], 0, &rc);
+
+	if (rc || count == 0) {
+		shell_error(sh, "Invalid argument: %d", rc);
+		return -EINVAL;
+	}
+
+	log_rpc_set_stream_level(LOG_RPC_LEVEL_DBG);
+	log_rpc_reset_stream_stats();
+	start = k_uptime_get();
+
+	log_rpc_echo_count(LOG_RPC_LEVEL_DBG, "Logging over RPC benchmark message", count);
+
+	/* Wait until all streamed messages are received or the stream stalls */
+	last_progress = k_uptime_get();
+
+	while (true) {
+		log_rpc_get_stream_stats(&stats);
+
+		if (stats.messages != last_messages) {
+			last_messages = stats.messages;
+			last_progress = k_uptime_get();
+		}
+
+		if (stats.messages >= count ||
+		    k_uptime_get() - last_progress > BENCH_DRAIN_TIMEOUT_MS) {
+			break;
+		}
+
+		k_msleep(BENCH_POLL_INTERVAL_MS);
+	}
+
+	elapsed = MAX(last_progress - start, 1);
+
+	shell_print(sh, "Received %u of %u messages in %u events, %lld ms", stats.messages, count,
+		    stats.events, elapsed);
+
+	if (stats.messages > 0) {
+		shell_print(sh, "%llu messages/s, %u bytes/message",
+			    (uint64_t)stats.messages * MSEC_PER_SEC / elapsed,
+			    stats.bytes / stats.messages);
+	}
+
+	return 0;
+}
+
 static int cmd_log_rpc_time(const struct shell *sh, size_t argc, char *argv[])
 {
 	int rc = 0;
@@ -295,6 +354,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      0),
 	SHELL_CMD_ARG(echo, NULL, "Generate log message on remote <0-4> <msg>", cmd_log_rpc_echo, 3,
 		      0),
+	SHELL_CMD_ARG(bench, NULL, "Measure log streaming throughput <count>", cmd_log_rpc_bench, 2,
+		      0),
 	SHELL_CMD_ARG(time, NULL, "Set current time <time_us|now>", cmd_log_rpc_time, 2, 0),
 	SHELL_CMD_ARG(crash_info, NULL, "Fetch crash dump summary", cmd_log_rpc_get_crash_info, 1,
 		      0),
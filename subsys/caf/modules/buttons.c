@@ -30,6 +30,7 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_CAF_BUTTONS_LOG_LEVEL);
 
 #define SCAN_INTERVAL CONFIG_CAF_BUTTONS_SCAN_INTERVAL
 #define DEBOUNCE_INTERVAL CONFIG_CAF_BUTTONS_DEBOUNCE_INTERVAL
+#define DEBOUNCE_SCANS CONFIG_CAF_BUTTONS_DEBOUNCE_SCANS
 
 /* For directly connected GPIO, scan rows once. */
 #define COLUMNS MAX(ARRAY_SIZE(col), 1)
@@ -72,6 +73,27 @@ static struct k_work_delayable button_pressed;
 static enum state state;
 static atomic_t system_power_off = ATOMIC_INIT(false);
 
+/* Port scanning data. */
+static uint8_t col_gpio_idx[COLUMNS];
+static uint8_t row_gpio_idx[ARRAY_SIZE(row)];
+static gpio_port_pins_t col_pins[ARRAY_SIZE(gpio_devs)];
+static gpio_port_pins_t row_pins[ARRAY_SIZE(gpio_devs)];
+static gpio_port_pins_t col_output[ARRAY_SIZE(gpio_devs)];
+static bool col_output_valid;
+
+/* Integrating debounce counters. */
+static uint8_t debounce_cnt[COLUMNS][ARRAY_SIZE(row)];
+
+struct latency_stats {
+	uint32_t press_cycles;
+	bool measure;
+	uint32_t min_us;
+	uint32_t max_us;
+	uint64_t sum_us;
+	uint32_t cnt;
+};
+
+static struct latency_stats latency;
 
 static int get_gpio_idx(uint8_t port)
 {
@@ -103,8 +125,87 @@ static uint32_t get_wakeup_mask(const struct gpio_pin *pins, size_t cnt)
 	return mask;
 }
 
+static int set_col_pin_dir(size_t i, bool output)
+{
+	gpio_flags_t flags;
+
+	if (output) {
+		flags = GPIO_OUTPUT;
+	} else {
+		/* The pull is necessary to ensure pin state and prevent unexpected
+		 * behaviour that could be triggered by accumulating charge.
+		 */
+		flags = GPIO_INPUT | (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED) ?
+				      (GPIO_PULL_UP) : (GPIO_PULL_DOWN));
+	}
+
+	return gpio_pin_configure(gpio_devs[col_gpio_idx[i]].dev, col[i].pin, flags);
+}
+
+static int set_cols_port(uint32_t mask)
+{
+	gpio_port_pins_t out[ARRAY_SIZE(gpio_devs)] = {0};
+	gpio_port_value_t val[ARRAY_SIZE(gpio_devs)] = {0};
+	int err = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(col); i++) {
+		uint8_t idx = col_gpio_idx[i];
+
+		if ((mask & BIT(i)) || !mask) {
+			out[idx] |= BIT(col[i].pin);
+		}
+		if (mask & BIT(i)) {
+			val[idx] |= BIT(col[i].pin);
+		}
+	}
+
+	for (size_t idx = 0; (idx < ARRAY_SIZE(gpio_devs)) && !err; idx++) {
+		if (!col_pins[idx]) {
+			continue;
+		}
+
+		if (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED)) {
+			val[idx] = ~val[idx];
+		}
+
+		/* Set the level before the pin is switched to output to avoid glitches. */
+		err = gpio_port_set_masked_raw(gpio_devs[idx].dev, out[idx], val[idx]);
+	}
+
+	for (size_t i = 0; (i < ARRAY_SIZE(col)) && !err; i++) {
+		uint8_t idx = col_gpio_idx[i];
+		bool output = out[idx] & BIT(col[i].pin);
+
+		if (col_output_valid &&
+		    (output == ((col_output[idx] & BIT(col[i].pin)) != 0))) {
+			/* Pin direction is not changed. */
+			continue;
+		}
+
+		err = set_col_pin_dir(i, output);
+		if (!err) {
+			WRITE_BIT(col_output[idx], col[i].pin, output);
+		}
+	}
+
+	if (err) {
+		/* Pin direction is unknown. Reconfigure all of the pins next time. */
+		col_output_valid = false;
+		LOG_ERR("Cannot set pin");
+		return -EFAULT;
+	}
+
+	col_output_valid = true;
+
+	return 0;
+}
+
 static int set_cols(uint32_t mask)
 {
+	if (IS_ENABLED(CONFIG_CAF_BUTTONS_PORT_SCAN)) {
+		return set_cols_port(mask);
+	}
+
 	for (size_t i = 0; i < ARRAY_SIZE(col); i++) {
 		uint32_t val = (mask & BIT(i)) ? (1) : (0);
 		int err;
@@ -142,8 +243,40 @@ static int set_cols(uint32_t mask)
 	return 0;
 }
 
+static int get_rows_port(uint32_t *mask)
+{
+	gpio_port_value_t val[ARRAY_SIZE(gpio_devs)] = {0};
+
+	for (size_t idx = 0; idx < ARRAY_SIZE(gpio_devs); idx++) {
+		if (!row_pins[idx]) {
+			continue;
+		}
+
+		if (gpio_port_get_raw(gpio_devs[idx].dev, &val[idx])) {
+			LOG_ERR("Cannot get port");
+			return -EFAULT;
+		}
+
+		if (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED)) {
+			val[idx] = ~val[idx];
+		}
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(row); i++) {
+		if (val[row_gpio_idx[i]] & BIT(row[i].pin)) {
+			*mask |= BIT(i);
+		}
+	}
+
+	return 0;
+}
+
 static int get_rows(uint32_t *mask)
 {
+	if (IS_ENABLED(CONFIG_CAF_BUTTONS_PORT_SCAN)) {
+		return get_rows_port(mask);
+	}
+
 	for (size_t i = 0; i < ARRAY_SIZE(row); i++) {
 		int val = gpio_pin_get_raw(get_gpio_dev(row[i].port), row[i].pin);
 
@@ -242,6 +375,57 @@ static int setup_pin_wakeup(void)
 	return err;
 }
 
+static bool debounce_integrate(uint32_t *raw_state, const uint32_t *settled_state)
+{
+	bool in_progress = false;
+
+	for (size_t i = 0; i < COLUMNS; i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(row); j++) {
+			uint8_t *cnt = &debounce_cnt[i][j];
+
+			if (raw_state[i] & BIT(j)) {
+				if (*cnt < DEBOUNCE_SCANS) {
+					(*cnt)++;
+				}
+			} else if (*cnt > 0) {
+				(*cnt)--;
+			}
+
+			/* Key state changes only when the counter saturates. */
+			if (*cnt == DEBOUNCE_SCANS) {
+				raw_state[i] |= BIT(j);
+			} else if (*cnt == 0) {
+				raw_state[i] &= ~BIT(j);
+			} else {
+				WRITE_BIT(raw_state[i], j, settled_state[i] & BIT(j));
+				in_progress = true;
+			}
+		}
+	}
+
+	return in_progress;
+}
+
+static void latency_update(void)
+{
+	uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - latency.press_cycles);
+
+	latency.measure = false;
+
+	if ((latency.cnt == 0) || (latency_us < latency.min_us)) {
+		latency.min_us = latency_us;
+	}
+	if (latency_us > latency.max_us) {
+		latency.max_us = latency_us;
+	}
+	latency.sum_us += latency_us;
+	latency.cnt++;
+
+	LOG_DBG("Press latency %" PRIu32 " us (min %" PRIu32 " avg %" PRIu32 " max %" PRIu32 ")",
+		latency_us, latency.min_us, (uint32_t)(latency.sum_us / latency.cnt),
+		latency.max_us);
+}
+
 static int suspend(void)
 {
 	int err = -EBUSY;
@@ -333,11 +517,18 @@ static void scan_fn(struct k_work *work)
 
 	/* Prevent bouncing */
 	static uint32_t prev_state[COLUMNS];
-	for (size_t i = 0; i < COLUMNS; i++) {
-		uint32_t bounce_mask = prev_state[i] ^ raw_state[i];
-		prev_state[i] = raw_state[i];
-		raw_state[i] &= ~bounce_mask;
-		raw_state[i] |= settled_state[i] & bounce_mask;
+	bool debounce_in_progress = false;
+
+	if (DEBOUNCE_SCANS > 0) {
+		debounce_in_progress = debounce_integrate(raw_state, settled_state);
+	} else {
+		for (size_t i = 0; i < COLUMNS; i++) {
+			uint32_t bounce_mask = prev_state[i] ^ raw_state[i];
+
+			prev_state[i] = raw_state[i];
+			raw_state[i] &= ~bounce_mask;
+			raw_state[i] |= settled_state[i] & bounce_mask;
+		}
 	}
 
 	/* Prevent ghosting */
@@ -359,7 +550,7 @@ static void scan_fn(struct k_work *work)
 	}
 
 	/* Emit event for any key state change */
-	bool any_pressed = false;
+	bool any_pressed = debounce_in_progress;
 	size_t evt_limit = 0;
 
 	for (size_t i = 0; i < COLUMNS; i++) {
@@ -377,6 +568,11 @@ static void scan_fn(struct k_work *work)
 				event->pressed = is_pressed;
 				APP_EVENT_SUBMIT(event);
 
+				if (IS_ENABLED(CONFIG_CAF_BUTTONS_LATENCY_STATS) &&
+				    is_pressed && latency.measure) {
+					latency_update();
+				}
+
 				evt_limit++;
 
 				WRITE_BIT(settled_state[i], j, is_pressed);
@@ -397,6 +593,9 @@ static void scan_fn(struct k_work *work)
 
 		int err = 0;
 
+		/* Press did not generate any event (e.g. it was a bounce). */
+		latency.measure = false;
+
 		/* Enable callbacks and switch state, then set pins */
 		switch (state) {
 		case STATE_SCANNING:
@@ -449,6 +648,10 @@ static void button_pressed_isr(const struct device *gpio_dev,
 		return;
 	}
 
+	if (IS_ENABLED(CONFIG_CAF_BUTTONS_LATENCY_STATS)) {
+		latency.press_cycles = k_cycle_get_32();
+	}
+
 	/* This is a workaround. Zephyr will set any pin triggering interrupt
 	 * at the moment. Not only our pins.
 	 */
@@ -506,6 +709,7 @@ static void button_pressed_fn(struct k_work *work)
 
 	case STATE_ACTIVE:
 		state = STATE_SCANNING;
+		latency.measure = IS_ENABLED(CONFIG_CAF_BUTTONS_LATENCY_STATS);
 		k_work_reschedule(&matrix_scan, K_MSEC(DEBOUNCE_INTERVAL));
 		break;
 
@@ -562,6 +766,16 @@ static void init_fn(void)
 		goto error;
 	}
 
+	for (size_t i = 0; i < ARRAY_SIZE(col); i++) {
+		col_gpio_idx[i] = get_gpio_idx(col[i].port);
+		col_pins[col_gpio_idx[i]] |= BIT(col[i].pin);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(row); i++) {
+		row_gpio_idx[i] = get_gpio_idx(row[i].port);
+		row_pins[row_gpio_idx[i]] |= BIT(row[i].pin);
+	}
+
 	for (size_t i = 0; i < ARRAY_SIZE(col); i++) {
 		int err = gpio_pin_configure(get_gpio_dev(col[i].port),
 					     col[i].pin, GPIO_INPUT);
@@ -11,6 +11,7 @@
 #include <caf/events/sensor_event.h>
 #include <caf/events/sensor_data_aggregator_event.h>
 #include <caf/sensor_manager.h>
+#include <caf/sensor_data_aggregator.h>
 
 #define MODULE sensor_data_aggregator
 #include <caf/events/module_state_event.h>
@@ -24,25 +25,25 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_CAF_SENSOR_DATA_AGGREGATOR_LOG_LEVEL);
 #define __AGG_BUFFS_NAME(agg_node) DT_CAT3(agg_, agg_node, _buffs)
 
 /* This macros are used only if no memory region is used and the aggregator buffers are created
- * in BSS.
+ * in BSS. The buffers are placed one after another, the same as in the memory region.
  */
-#define __DATA_BUFF_NAME(agg_node, n) DT_CAT5(agg_, agg_node,  _buff_,  n,  _data)
-#define __DEFINE_DATA(n, agg_node, size)                         \
-	static struct sensor_value __DATA_BUFF_NAME(agg_node, n) \
-		[DIV_ROUND_UP(size, sizeof(struct sensor_value))]
+#define __DATA_BUFF_NAME(agg_node) DT_CAT3(agg_, agg_node, _buff_data)
+#define __DEFINE_DATA(agg_node, cnt, size)                                      \
+	static struct sensor_value __DATA_BUFF_NAME(agg_node)                   \
+		[cnt][DIV_ROUND_UP(size, sizeof(struct sensor_value))]
 /* End of BSS version only macros. */
 
 #define __INITIALIZE_BUFF(n, agg_node)                                                        \
 	COND_CODE_1(DT_NODE_HAS_PROP(agg_node, memory_region),                                \
 		({(struct sensor_value *) (DT_REG_ADDR(DT_PHANDLE(agg_node, memory_region)) + \
 			n * (DT_PROP(agg_node, buf_data_length)))}),                          \
-		({__DATA_BUFF_NAME(agg_node, n)})                                             \
+		({__DATA_BUFF_NAME(agg_node)[n]})                                             \
 	)
 
 #define __XDEFINE_BUF_DATA(agg_node)                                                    \
 	COND_CODE_0(DT_NODE_HAS_PROP(agg_node, memory_region),                          \
-		(LISTIFY(DT_PROP(agg_node, buf_count), __DEFINE_DATA, (;),              \
-			agg_node, DT_PROP(agg_node, buf_data_length));),                \
+		(__DEFINE_DATA(agg_node, DT_PROP(agg_node, buf_count),                  \
+			DT_PROP(agg_node, buf_data_length));),                          \
 		()                                                                      \
 	)                                                                               \
 	static struct aggregator_buffer __AGG_BUFFS_NAME(agg_node)[] = {                \
@@ -73,10 +74,13 @@ struct aggregator {
 	const char *sensor_descr;		/* sensor_description of the sensor. */
 	struct aggregator_buffer *agg_buffers;	/* Buffers. */
 	struct aggregator_buffer *active_buf;	/* Active buffer to which data will be placed. */
+	struct aggregator_buffer *next_buf;	/* Next buffer in order (direct write mode). */
 	enum sensor_state sensor_state;		/* Sensors state. */
 	const uint8_t values_in_sample;		/* Number of sensor values in a sample. */
 	const uint8_t buf_count;		/* Number of buffers. */
 	const uint8_t buf_len;			/* Size of buffor data in bytes. */
+	bool claimed;				/* Active buffer is claimed by a producer. */
+	bool flush_pending;			/* Active buffer must be sent on commit. */
 };
 
 
@@ -85,6 +89,9 @@ static struct aggregator aggregators[] = {
 	DT_INST_FOREACH_STATUS_OKAY(__DEFINE_AGGREGATOR)
 };
 
+/* Protects the aggregators that are written directly by producers. */
+static struct k_spinlock agg_lock;
+
 
 static struct aggregator_buffer *get_free_buffer(struct aggregator *agg)
 {
@@ -96,6 +103,21 @@ static struct aggregator_buffer *get_free_buffer(struct aggregator *agg)
 	return NULL;
 }
 
+static struct aggregator_buffer *get_buffer(struct aggregator *agg,
+					    const struct sensor_value *samples)
+{
+	/* All buffers of an aggregator are placed one after another in memory. */
+	size_t buf_values = agg->buf_len / sizeof(struct sensor_value);
+	ptrdiff_t offset = samples - agg->agg_buffers[0].samples;
+
+	if ((offset < 0) || ((offset % buf_values) != 0) ||
+	    ((offset / buf_values) >= agg->buf_count)) {
+		return NULL;
+	}
+
+	return &agg->agg_buffers[offset / buf_values];
+}
+
 static struct aggregator *get_aggregator(const char *sensor_descr)
 {
 	for (size_t i = 0; i < ARRAY_SIZE(aggregators); i++) {
@@ -106,6 +128,28 @@ static struct aggregator *get_aggregator(const char *sensor_descr)
 	return NULL;
 }
 
+static size_t get_samples_in_buf(const struct aggregator *agg)
+{
+	return agg->buf_len / (agg->values_in_sample * sizeof(struct sensor_value));
+}
+
+static void activate_next_buffer(struct aggregator *agg, struct aggregator_buffer *sent)
+{
+	if (IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT_WRITE)) {
+		/* The buffers are used as a ring to keep consecutive data windows in order. */
+		struct aggregator_buffer *next = sent + 1;
+
+		if (next == &agg->agg_buffers[agg->buf_count]) {
+			next = agg->agg_buffers;
+		}
+
+		agg->next_buf = next;
+		agg->active_buf = next->busy ? NULL : next;
+	} else {
+		agg->active_buf = get_free_buffer(agg);
+	}
+}
+
 static void release_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
 {
 	__ASSERT_NO_MSG(ab);
@@ -113,29 +157,130 @@ static void release_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
 	ab->sample_cnt = 0;
 	ab->busy = false;
 	if (agg->active_buf == NULL) {
-		agg->active_buf = ab;
+		if (!IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT_WRITE) ||
+		    (ab == agg->next_buf)) {
+			agg->active_buf = ab;
+		}
 	}
 }
 
-static void send_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
+static void submit_buffer_event(const struct aggregator *agg, struct sensor_value *samples,
+				uint8_t sample_cnt, enum sensor_state sensor_state)
 {
-	ab->busy = true;
 	struct sensor_data_aggregator_event *event = new_sensor_data_aggregator_event();
+
 	event->values_in_sample = agg->values_in_sample;
-	event->samples = ab->samples;
-	event->sample_cnt = ab->sample_cnt;
-	event->sensor_state = agg->sensor_state;
+	event->samples = samples;
+	event->sample_cnt = sample_cnt;
+	event->sensor_state = sensor_state;
 	event->sensor_descr = agg->sensor_descr;
 	APP_EVENT_SUBMIT(event);
 }
 
-static int enqueue_sample(struct aggregator *agg, struct sensor_event *event)
+#ifdef CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT_WRITE
+static int claim(struct aggregator *agg, struct sensor_value **samples)
 {
-	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
+	k_spinlock_key_t key = k_spin_lock(&agg_lock);
+	struct aggregator_buffer *ab = agg->active_buf;
+	int ret;
+
+	if (!ab) {
+		ret = -ENOMEM;
+	} else if (agg->claimed) {
+		ret = -EBUSY;
+	} else {
+		*samples = &ab->samples[ab->sample_cnt * agg->values_in_sample];
+		ret = get_samples_in_buf(agg) - ab->sample_cnt;
+		agg->claimed = true;
+	}
+
+	k_spin_unlock(&agg_lock, key);
+
+	return ret;
+}
+
+static void commit(struct aggregator *agg, size_t sample_cnt)
+{
+	k_spinlock_key_t key = k_spin_lock(&agg_lock);
+	struct aggregator_buffer *ab = agg->active_buf;
+	bool send = false;
+	uint8_t buf_sample_cnt;
+	enum sensor_state sensor_state;
+
+	__ASSERT_NO_MSG(agg->claimed && ab);
+	__ASSERT_NO_MSG(ab->sample_cnt + sample_cnt <= get_samples_in_buf(agg));
+
+	ab->sample_cnt += sample_cnt;
+	agg->claimed = false;
+
+	if ((ab->sample_cnt == get_samples_in_buf(agg)) || agg->flush_pending) {
+		agg->flush_pending = false;
+		ab->busy = true;
+		buf_sample_cnt = ab->sample_cnt;
+		sensor_state = agg->sensor_state;
+		activate_next_buffer(agg, ab);
+		send = true;
+	}
+
+	k_spin_unlock(&agg_lock, key);
+
+	/* The buffer is owned by the consumer until it is released. */
+	if (send) {
+		submit_buffer_event(agg, ab->samples, buf_sample_cnt, sensor_state);
+	}
+}
 
-	if ((event->dyndata.size) != chunk_bytes) {
+int sensor_data_aggregator_claim(const char *sensor_descr, uint8_t values_in_sample,
+				 struct sensor_value **samples)
+{
+	struct aggregator *agg = get_aggregator(sensor_descr);
+
+	if (!agg) {
+		return -ENOENT;
+	}
+
+	if (agg->values_in_sample != values_in_sample) {
 		return -EBADMSG;
 	}
+
+	return claim(agg, samples);
+}
+
+void sensor_data_aggregator_commit(const char *sensor_descr, size_t sample_cnt)
+{
+	struct aggregator *agg = get_aggregator(sensor_descr);
+
+	__ASSERT_NO_MSG(agg);
+
+	commit(agg, sample_cnt);
+}
+
+static int enqueue_sample(struct aggregator *agg, const struct sensor_value *sample)
+{
+	struct sensor_value *dst;
+	int ret = claim(agg, &dst);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	memcpy(dst, sample, agg->values_in_sample * sizeof(struct sensor_value));
+	commit(agg, 1);
+
+	return 0;
+}
+
+#else
+static void send_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
+{
+	ab->busy = true;
+	submit_buffer_event(agg, ab->samples, ab->sample_cnt, agg->sensor_state);
+}
+
+static int enqueue_sample(struct aggregator *agg, const struct sensor_value *sample)
+{
+	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
+
 	if (!agg->active_buf) {
 		return -ENOMEM;
 	}
@@ -148,17 +293,66 @@ static int enqueue_sample(struct aggregator *agg, struct sensor_event *event)
 		__ASSERT_NO_MSG(false);
 		return -ENOMEM;
 	}
-	memcpy(&ab->samples[pos_values], (uint8_t *)event->dyndata.data, chunk_bytes);
+	memcpy(&ab->samples[pos_values], sample, chunk_bytes);
 	ab->sample_cnt++;
 	avail_bytes -= chunk_bytes;
 
 	if (avail_bytes < chunk_bytes) {
 		send_buffer(agg, ab);
-		agg->active_buf = get_free_buffer(agg);
+		activate_next_buffer(agg, ab);
 	}
 
 	return 0;
 }
+#endif /* CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT_WRITE */
+
+static int enqueue_samples(struct aggregator *agg, struct sensor_event *event)
+{
+	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
+	const struct sensor_value *data = sensor_event_get_data_ptr(event);
+
+	/* A single sensor event may contain a batch of samples (streamed sensors). */
+	if ((event->dyndata.size == 0) || ((event->dyndata.size % chunk_bytes) != 0)) {
+		return -EBADMSG;
+	}
+
+	for (size_t i = 0; i < event->dyndata.size / chunk_bytes; i++) {
+		int err = enqueue_sample(agg, &data[i * agg->values_in_sample]);
+
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static void handle_sensor_state(struct aggregator *agg, enum sensor_state state)
+{
+	k_spinlock_key_t key = k_spin_lock(&agg_lock);
+	struct aggregator_buffer *ab = agg->active_buf;
+
+	agg->sensor_state = state;
+
+	if (!ab) {
+		k_spin_unlock(&agg_lock, key);
+		LOG_WRN("No buffer to report %s sensor state", agg->sensor_descr);
+		return;
+	}
+
+	if (agg->claimed) {
+		/* Producer writes to the buffer. The buffer is sent on commit. */
+		agg->flush_pending = true;
+		k_spin_unlock(&agg_lock, key);
+		return;
+	}
+
+	ab->busy = true;
+	activate_next_buffer(agg, ab);
+	k_spin_unlock(&agg_lock, key);
+
+	submit_buffer_event(agg, ab->samples, ab->sample_cnt, state);
+}
 
 static bool event_handler(const struct app_event_header *aeh)
 {
@@ -167,7 +361,7 @@ static bool event_handler(const struct app_event_header *aeh)
 		struct aggregator *agg = get_aggregator(event->descr);
 
 		if (agg) {
-			int err = enqueue_sample(agg, event);
+			int err = enqueue_samples(agg, event);
 
 			if (err) {
 				LOG_ERR("Error code: %d", err);
@@ -186,11 +380,15 @@ static bool event_handler(const struct app_event_header *aeh)
 
 		__ASSERT_NO_MSG(agg);
 
-		for (size_t i = 0; i < agg->buf_count; i++) {
-			if (agg->agg_buffers[i].samples == event->samples) {
-				release_buffer(agg, &agg->agg_buffers[i]);
-				break;
-			}
+		struct aggregator_buffer *ab = get_buffer(agg, event->samples);
+
+		if (ab) {
+			k_spinlock_key_t key = k_spin_lock(&agg_lock);
+
+			release_buffer(agg, ab);
+			k_spin_unlock(&agg_lock, key);
+		} else {
+			LOG_WRN("Released unknown buffer of %s", agg->sensor_descr);
 		}
 
 		return false;
@@ -201,11 +399,7 @@ static bool event_handler(const struct app_event_header *aeh)
 		struct aggregator *agg = get_aggregator(event->descr);
 
 		if (agg) {
-			struct aggregator_buffer *ab = agg->active_buf;
-
-			agg->sensor_state = event->state;
-			send_buffer(agg, ab);
-			agg->active_buf = get_free_buffer(agg);
+			handle_sensor_state(agg, event->state);
 		}
 
 		return false;
@@ -7,9 +7,13 @@
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/pm/device.h>
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+#include <zephyr/rtio/rtio.h>
+#endif
 
 #include <caf/events/sensor_event.h>
 #include <caf/sensor_manager.h>
+#include <caf/sensor_data_aggregator.h>
 
 #include CONFIG_CAF_SENSOR_MANAGER_DEF_PATH
 
@@ -31,13 +35,38 @@ struct sensor_data {
 	atomic_t state;
 	unsigned int sleep_cntd;
 	atomic_t event_cnt;
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+	struct rtio_sqe *stream_handle;
+#endif
 };
 
 static struct sensor_data sensor_data[ARRAY_SIZE(sensor_configs)];
 
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+#define STREAM_MAX_BATCH	CONFIG_CAF_SENSOR_MANAGER_STREAMING_MAX_BATCH
+#define STREAM_QUEUE_SIZE	CONFIG_CAF_SENSOR_MANAGER_STREAMING_QUEUE_SIZE
+
+RTIO_DEFINE_WITH_MEMPOOL(stream_ctx, STREAM_QUEUE_SIZE, STREAM_QUEUE_SIZE,
+			 CONFIG_CAF_SENSOR_MANAGER_STREAMING_BUF_CNT,
+			 CONFIG_CAF_SENSOR_MANAGER_STREAMING_BUF_SIZE, sizeof(void *));
+
+/* Decoded data of a single channel. Buffer is big enough to hold the biggest batch of
+ * three-axis readings. It is used only from the sample thread.
+ */
+static uint8_t stream_decode_buf[sizeof(struct sensor_three_axis_data) +
+				 (STREAM_MAX_BATCH - 1) *
+				 sizeof(struct sensor_three_axis_sample_data)] __aligned(sizeof(q31_t));
+#endif /* CONFIG_CAF_SENSOR_MANAGER_STREAMING */
+
 static K_THREAD_STACK_DEFINE(sample_thread_stack, SAMPLE_THREAD_STACK_SIZE);
 static struct k_thread sample_thread;
 static struct k_sem can_sample;
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+/* The sample thread is also woken up by stream completions. Stream data is processed right
+ * after it is read, so that the RTIO memory pool does not run out of blocks.
+ */
+static struct k_poll_event sample_events[2];
+#endif
 
 
 static void update_sensor_state(const struct sm_sensor_config *sc, struct sensor_data *sd,
@@ -105,6 +134,219 @@ static size_t get_sensor_data_cnt(const struct sm_sensor_config *sc)
 	return data_cnt;
 }
 
+static bool is_sensor_streamed(const struct sm_sensor_config *sc)
+{
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+	return (sc->stream_iodev != NULL);
+#else
+	return false;
+#endif
+}
+
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+static int stream_start(const struct sm_sensor_config *sc, struct sensor_data *sd)
+{
+	__ASSERT_NO_MSG(!sd->stream_handle);
+
+	int err = sensor_stream(sc->stream_iodev, &stream_ctx, (void *)sc, &sd->stream_handle);
+
+	if (err) {
+		LOG_ERR("Cannot start %s sensor stream (err %d)", sc->dev->name, err);
+		sd->stream_handle = NULL;
+	}
+
+	return err;
+}
+
+static void stream_stop(struct sensor_data *sd)
+{
+	if (sd->stream_handle) {
+		(void)rtio_sqe_cancel(sd->stream_handle);
+		sd->stream_handle = NULL;
+	}
+}
+
+static void q31_to_sensor_value(q31_t q, int8_t shift, struct sensor_value *val)
+{
+	__ASSERT_NO_MSG((shift > -32) && (shift < 31));
+
+	int64_t micro = ((int64_t)q * 1000000) >> (31 - shift);
+
+	(void)sensor_value_from_micro(val, micro);
+}
+
+static int stream_decode_chan(struct sensor_decode_context *ctx,
+			      const struct caf_sampled_channel *sampled_chan,
+			      struct sensor_value *data, size_t sample_size, uint16_t frame_cnt)
+{
+	uint16_t decoded = 0;
+
+	while (decoded < frame_cnt) {
+		int ret = sensor_decode(ctx, stream_decode_buf, frame_cnt - decoded);
+
+		if (ret <= 0) {
+			return (ret < 0) ? ret : -ENODATA;
+		}
+
+		for (size_t i = 0; i < ret; i++) {
+			struct sensor_value *out = &data[(decoded + i) * sample_size];
+
+			if (sampled_chan->data_cnt == 3) {
+				const struct sensor_three_axis_data *d =
+					(const struct sensor_three_axis_data *)stream_decode_buf;
+
+				for (size_t axis = 0; axis < 3; axis++) {
+					q31_to_sensor_value(d->readings[i].values[axis], d->shift,
+							    &out[axis]);
+				}
+			} else {
+				const struct sensor_q31_data *d =
+					(const struct sensor_q31_data *)stream_decode_buf;
+
+				__ASSERT_NO_MSG(sampled_chan->data_cnt == 1);
+				q31_to_sensor_value(d->readings[i].value, d->shift, out);
+			}
+		}
+
+		decoded += ret;
+	}
+
+	return 0;
+}
+
+static int stream_decode_frames(const struct sm_sensor_config *sc,
+				struct sensor_decode_context *ctx,
+				struct sensor_value *data, uint16_t frame_cnt)
+{
+	size_t sample_size = get_sensor_data_cnt(sc);
+	size_t data_idx = 0;
+	int err = 0;
+
+	for (size_t i = 0; !err && (i < sc->chan_cnt); i++) {
+		err = stream_decode_chan(&ctx[i], &sc->chans[i], &data[data_idx], sample_size,
+					 frame_cnt);
+		data_idx += sc->chans[i].data_cnt;
+	}
+
+	return err;
+}
+
+static int stream_process_data(const struct sm_sensor_config *sc, struct sensor_data *sd,
+			       const uint8_t *buf)
+{
+	const struct sensor_decoder_api *decoder;
+	const struct sensor_chan_spec chan_spec = {
+		.chan_type = sc->chans[0].chan,
+		.chan_idx = 0,
+	};
+	size_t sample_size = get_sensor_data_cnt(sc);
+	uint16_t frame_cnt;
+
+	int err = sensor_get_decoder(sc->dev, &decoder);
+
+	if (!err) {
+		err = decoder->get_frame_count(buf, chan_spec, &frame_cnt);
+	}
+
+	if (err) {
+		return err;
+	}
+
+	struct sensor_decode_context ctx[sc->chan_cnt];
+
+	for (size_t i = 0; i < sc->chan_cnt; i++) {
+		ctx[i] = (struct sensor_decode_context)
+			SENSOR_DECODE_CONTEXT_INIT(decoder, buf, sc->chans[i].chan, 0);
+	}
+
+	while (IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT_WRITE) && (frame_cnt > 0)) {
+		struct sensor_value *data_ptr;
+		int ret = sensor_data_aggregator_claim(sc->event_descr, sample_size, &data_ptr);
+
+		if (ret == -ENOENT) {
+			/* No aggregator for the sensor, use sensor events. */
+			break;
+		} else if (ret < 0) {
+			LOG_WRN("Dropped %u samples due to no aggregator buffer for sensor: %s",
+				frame_cnt, sc->dev->name);
+			return 0;
+		}
+
+		uint16_t batch = MIN(frame_cnt, MIN(ret, STREAM_MAX_BATCH));
+
+		err = stream_decode_frames(sc, ctx, data_ptr, batch);
+		sensor_data_aggregator_commit(sc->event_descr, err ? 0 : batch);
+
+		if (err) {
+			return err;
+		}
+
+		frame_cnt -= batch;
+	}
+
+	while (frame_cnt > 0) {
+		uint16_t batch = MIN(frame_cnt, STREAM_MAX_BATCH);
+
+		if (atomic_get(&sd->event_cnt) >= sc->active_events_limit) {
+			LOG_WRN("Dropped %u samples due to too many active events on sensor: %s",
+				frame_cnt, sc->dev->name);
+			break;
+		}
+
+		struct sensor_event *event =
+			new_sensor_event(sizeof(struct sensor_value) * sample_size * batch);
+
+		event->descr = sc->event_descr;
+		err = stream_decode_frames(sc, ctx, sensor_event_get_data_ptr(event), batch);
+
+		if (err) {
+			app_event_manager_free(event);
+			return err;
+		}
+
+		atomic_inc(&sd->event_cnt);
+		APP_EVENT_SUBMIT(event);
+
+		frame_cnt -= batch;
+	}
+
+	return 0;
+}
+
+static void stream_process(void)
+{
+	struct rtio_cqe *cqe;
+
+	while ((cqe = rtio_cqe_consume(&stream_ctx)) != NULL) {
+		const struct sm_sensor_config *sc = cqe->userdata;
+		struct sensor_data *sd = get_sensor_data(sc->dev);
+		int err = cqe->result;
+		uint8_t *buf = NULL;
+		uint32_t buf_len = 0;
+
+		if (!err) {
+			err = rtio_cqe_get_mempool_buffer(&stream_ctx, cqe, &buf, &buf_len);
+		}
+		rtio_cqe_release(&stream_ctx, cqe);
+
+		/* Data may still be received right after the sensor was put to sleep. */
+		if (!err && (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE)) {
+			err = stream_process_data(sc, sd, buf);
+		}
+
+		if (buf) {
+			rtio_release_buffer(&stream_ctx, buf, buf_len);
+		}
+
+		if (err && (atomic_get(&sd->state) != SENSOR_STATE_ERROR)) {
+			LOG_ERR("Sensor stream error (err %d)", err);
+			stream_stop(sd);
+			update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+		}
+	}
+}
+#endif /* CONFIG_CAF_SENSOR_MANAGER_STREAMING */
+
 static void reset_sensor_sleep_cnt(const struct sm_sensor_config *sc,
 				   struct sensor_data *sd)
 {
@@ -219,10 +461,25 @@ static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config
 {
 	size_t data_idx = 0;
 	size_t data_cnt = get_sensor_data_cnt(sc);
-	struct sensor_value data[data_cnt];
+	struct sensor_value local_data[data_cnt];
+	struct sensor_value *data = local_data;
+	bool direct_write = false;
+	bool drop = false;
 
 	int err = sensor_sample_fetch(sc->dev);
 
+	if (!err && IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT_WRITE)) {
+		/* Place the sample directly in the aggregator buffer, if the sensor has one. */
+		int ret = sensor_data_aggregator_claim(sc->event_descr, data_cnt, &data);
+
+		if (ret > 0) {
+			direct_write = true;
+		} else {
+			data = local_data;
+			drop = (ret != -ENOENT);
+		}
+	}
+
 	for (size_t i = 0; !err && (i < sc->chan_cnt); i++) {
 		const struct caf_sampled_channel *sampled_chan = &sc->chans[i];
 
@@ -231,23 +488,33 @@ static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config
 	}
 
 	if (err) {
+		if (direct_write) {
+			sensor_data_aggregator_commit(sc->event_descr, 0);
+		}
+
 		LOG_ERR("Sensor sampling error (err %d)", err);
 		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
 	} else {
-		if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
-			send_sensor_event(sc->event_descr, data, ARRAY_SIZE(data),
-					  &sd->event_cnt);
+		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
+			process_sensor_activity(sc, sd, data);
+		}
+
+		if (direct_write) {
+			sensor_data_aggregator_commit(sc->event_descr, 1);
+		} else if (drop) {
+			LOG_WRN("Did not store sample due to no aggregator buffer on sensor: %s",
+				sc->dev->name);
+		} else if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
+			send_sensor_event(sc->event_descr, data, data_cnt, &sd->event_cnt);
 		} else {
 			LOG_WRN("Did not send event due to too many active events on sensor: %s",
 				sc->dev->name);
 		}
 
 		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
-			process_sensor_activity(sc, sd, data);
 			if (!is_sensor_active(sd)) {
 				enter_sleep(sc, sd);
 			}
-
 		}
 	}
 }
@@ -259,12 +526,21 @@ static size_t sample_sensors(int64_t *next_timeout)
 
 	*next_timeout = INT64_MAX;
 
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+	stream_process();
+#endif
+
 	for (size_t i = 0; i < ARRAY_SIZE(sensor_data); i++) {
 		struct sensor_data *sd = &sensor_data[i];
 		const struct sm_sensor_config *sc = &sensor_configs[i];
 
 		if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
-			if (sd->sample_timeout <= cur_uptime) {
+			/* Stream data is processed on every wake up, a streamed sensor is not
+			 * sampled.
+			 */
+			bool streamed = is_sensor_streamed(sc);
+
+			if (!streamed && (sd->sample_timeout <= cur_uptime)) {
 				sample_sensor(sd, sc);
 			}
 
@@ -274,7 +550,7 @@ static size_t sample_sensors(int64_t *next_timeout)
 				drops++;
 			}
 
-			if (drops > 0) {
+			if (!streamed && (drops > 0)) {
 				LOG_WRN("%d sample dropped", drops);
 			}
 		}
@@ -390,6 +666,17 @@ static size_t sensor_init(void)
 		sd->sampling_period = sc->sampling_period_ms;
 		sd->sample_timeout = cur_uptime + sc->sampling_period_ms;
 
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+		if (is_sensor_streamed(sc)) {
+			__ASSERT(!sc->trigger, "Streamed sensor cannot use trigger");
+
+			if (stream_start(sc, sd)) {
+				update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+				continue;
+			}
+		}
+#endif
+
 		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
 			int err = sensor_trigger_init(sc, sd);
 
@@ -407,12 +694,36 @@ static size_t sensor_init(void)
 	return alive_sensors;
 }
 
+static void sample_wait(int64_t next_timeout)
+{
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+	(void)k_poll(sample_events, ARRAY_SIZE(sample_events), K_TIMEOUT_ABS_MS(next_timeout));
+
+	/* The completion semaphore is taken when the completions are consumed. */
+	if (sample_events[0].state == K_POLL_STATE_SEM_AVAILABLE) {
+		(void)k_sem_take(&can_sample, K_NO_WAIT);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_events); i++) {
+		sample_events[i].state = K_POLL_STATE_NOT_READY;
+	}
+#else
+	(void)k_sem_take(&can_sample, K_TIMEOUT_ABS_MS(next_timeout));
+#endif
+}
+
 static void sample_thread_fn(void)
 {
 	size_t alive_sensors = 0;
 	int64_t next_timeout = 0;
 
 	k_sem_init(&can_sample, 0, 1);
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+	k_poll_event_init(&sample_events[0], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &can_sample);
+	k_poll_event_init(&sample_events[1], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, stream_ctx.consume_sem);
+#endif
 
 	alive_sensors = sensor_init();
 
@@ -420,7 +731,7 @@ static void sample_thread_fn(void)
 		module_set_state(MODULE_STATE_READY);
 
 		while (alive_sensors > 0) {
-			k_sem_take(&can_sample, K_TIMEOUT_ABS_MS(next_timeout));
+			sample_wait(next_timeout);
 
 			alive_sensors = sample_sensors(&next_timeout);
 			configure_max_power_state();
@@ -452,6 +763,9 @@ static bool handle_power_down_event(const struct app_event_header *aeh)
 			} else if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
 				int ret = 0;
 
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+				stream_stop(sd);
+#endif
 				if (sc->suspend) {
 					ret = pm_device_action_run(sc->dev,
 								   PM_DEVICE_ACTION_SUSPEND);
@@ -496,6 +810,15 @@ static bool handle_wake_up_event(const struct app_event_header *aeh)
 				}
 			}
 
+#ifdef CONFIG_CAF_SENSOR_MANAGER_STREAMING
+			if (!ret && is_sensor_streamed(sc) && !sd->stream_handle) {
+				ret = stream_start(sc, sd);
+				if (ret) {
+					update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+				}
+			}
+#endif
+
 			if (!ret) {
 				LOG_DBG("Sensor %s wake up", sc->dev->name);
 				sensor_wake_up_post(sc, sd);
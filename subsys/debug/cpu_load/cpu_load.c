@@ -228,6 +228,56 @@ static int cmd_cpu_load_reset(const struct shell *shell,
 	return 0;
 }
 
+#ifdef CONFIG_NRF_CPU_LOAD_STATS
+static void print_dist(const struct shell *shell, const struct cpu_load_dist *dist)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "%3d,%03d%% %3d,%03d%% %3d,%03d%%",
+		      dist->p50 / 1000, dist->p50 % 1000,
+		      dist->p99 / 1000, dist->p99 % 1000,
+		      dist->max / 1000, dist->max % 1000);
+}
+
+static int cmd_cpu_load_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	struct cpu_load_thread_stats thread_stats;
+
+	shell_print(shell, "%-24s %-9s%-9s%s", "Thread", "p50", "p99", "max");
+	for (size_t i = 0; cpu_load_thread_stats_get(i, &thread_stats) == 0; i++) {
+		const char *name = k_thread_name_get((k_tid_t)thread_stats.thread);
+
+		if (name && (name[0] != '\0')) {
+			shell_fprintf(shell, SHELL_NORMAL, "%-24s ", name);
+		} else {
+			shell_fprintf(shell, SHELL_NORMAL, "%-24p ", thread_stats.thread);
+		}
+		print_dist(shell, &thread_stats.load);
+		shell_fprintf(shell, SHELL_NORMAL, "\n");
+	}
+
+#ifdef CONFIG_NRF_CPU_LOAD_STATS_IRQ
+	struct cpu_load_irq_stats irq_stats;
+
+	shell_print(shell, "%-24s %-9s%-9s%-9s%-10s%s", "IRQ", "p50", "p99", "max",
+		    "ISR max", "count");
+	for (size_t i = 0; cpu_load_irq_stats_get(i, &irq_stats) == 0; i++) {
+		shell_fprintf(shell, SHELL_NORMAL, "%-24d ", irq_stats.irq);
+		print_dist(shell, &irq_stats.load);
+		shell_fprintf(shell, SHELL_NORMAL, " %6dus %u\n",
+			      irq_stats.isr_max_us, irq_stats.count);
+	}
+#endif
+
+	return 0;
+}
+
+static int cmd_cpu_load_stats_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	cpu_load_stats_reset();
+
+	return 0;
+}
+#endif /* CONFIG_NRF_CPU_LOAD_STATS */
+
 SYS_INIT(cpu_load_init_internal, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmd_cpu_load,
@@ -236,6 +286,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmd_cpu_load,
 			cmd_cpu_load_reset, 1, 0),
 	SHELL_CMD_ARG(init, NULL, "Init",
 			cmd_cpu_load_reset, 1, 0),
+	SHELL_COND_CMD_ARG(CONFIG_NRF_CPU_LOAD_STATS, stats, NULL,
+			"Get per-thread and per-interrupt load", cmd_cpu_load_stats, 1, 0),
+	SHELL_COND_CMD_ARG(CONFIG_NRF_CPU_LOAD_STATS, stats_reset, NULL,
+			"Reset per-thread and per-interrupt load", cmd_cpu_load_stats_reset, 1, 0),
 	SHELL_SUBCMD_SET_END
 );
 
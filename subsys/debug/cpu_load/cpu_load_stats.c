@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <debug/cpu_load.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <string.h>
+#ifdef CONFIG_NRF_CPU_LOAD_STATS_IRQ
+#include <cmsis_core.h>
+#include <zephyr/arch/arm/cortex_m/dwt.h>
+#include <tracing_user.h>
+#endif
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(cpu_load, CONFIG_NRF_CPU_LOAD_LOG_LEVEL);
+
+#define FULL_LOAD 100000
+
+/* Each histogram bucket covers 2% of load. */
+#define HIST_BUCKET_WIDTH 2000
+#define HIST_BUCKET_COUNT (FULL_LOAD / HIST_BUCKET_WIDTH + 1)
+
+/** Distribution of the load measured in the subsequent windows. */
+struct load_hist {
+	uint16_t buckets[HIST_BUCKET_COUNT];
+	uint32_t total;
+	uint32_t max;
+};
+
+struct thread_slot {
+	const struct k_thread *thread;
+	uint64_t cycles_ref;
+	bool seen;
+	struct load_hist hist;
+};
+
+static struct thread_slot threads[CONFIG_NRF_CPU_LOAD_STATS_THREADS];
+static uint64_t total_cycles_ref;
+static struct k_spinlock stats_lock;
+static struct k_work_delayable window_work;
+
+static void hist_add(struct load_hist *hist, uint32_t load)
+{
+	uint16_t *bucket = &hist->buckets[MIN(load, FULL_LOAD) / HIST_BUCKET_WIDTH];
+
+	/* Halve the history on saturation, so that recent windows weigh more. */
+	if (*bucket == UINT16_MAX) {
+		hist->total = 0;
+		for (size_t i = 0; i < ARRAY_SIZE(hist->buckets); i++) {
+			hist->buckets[i] /= 2;
+			hist->total += hist->buckets[i];
+		}
+	}
+
+	(*bucket)++;
+	hist->total++;
+	hist->max = MAX(hist->max, load);
+}
+
+static uint32_t hist_percentile(const struct load_hist *hist, uint32_t percent)
+{
+	uint32_t target = DIV_ROUND_UP(hist->total * percent, 100);
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(hist->buckets); i++) {
+		sum += hist->buckets[i];
+		if ((sum > 0) && (sum >= target)) {
+			/* Upper edge of the bucket, but never above the exact maximum. */
+			return MIN((i + 1) * HIST_BUCKET_WIDTH - 1, hist->max);
+		}
+	}
+
+	return hist->max;
+}
+
+static void hist_dist_get(const struct load_hist *hist, struct cpu_load_dist *dist)
+{
+	dist->p50 = hist_percentile(hist, 50);
+	dist->p99 = hist_percentile(hist, 99);
+	dist->max = hist->max;
+}
+
+static uint32_t load_calc(uint64_t cycles, uint64_t total)
+{
+	return (total > 0) ? (uint32_t)MIN((cycles * FULL_LOAD) / total, FULL_LOAD) : 0;
+}
+
+static struct thread_slot *thread_slot_get(const struct k_thread *thread)
+{
+	struct thread_slot *free_slot = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(threads); i++) {
+		if (threads[i].thread == thread) {
+			return &threads[i];
+		}
+		if (!free_slot && !threads[i].thread) {
+			free_slot = &threads[i];
+		}
+	}
+
+	return free_slot;
+}
+
+struct thread_window {
+	uint64_t total;
+	bool first;
+};
+
+static void thread_window_cb(const struct k_thread *thread, void *user_data)
+{
+	struct thread_window *window = user_data;
+	struct thread_slot *slot = thread_slot_get(thread);
+	k_thread_runtime_stats_t rt_stats;
+	bool new_slot;
+
+	if (!slot) {
+		/* All slots are taken, the thread is not tracked. */
+		return;
+	}
+
+	if (k_thread_runtime_stats_get((k_tid_t)thread, &rt_stats)) {
+		return;
+	}
+
+	K_SPINLOCK(&stats_lock) {
+		new_slot = (slot->thread == NULL);
+		if (new_slot) {
+			memset(slot, 0, sizeof(*slot));
+			slot->thread = thread;
+		} else if (!window->first) {
+			hist_add(&slot->hist,
+				 load_calc(rt_stats.execution_cycles - slot->cycles_ref,
+					   window->total));
+		}
+		/* First window of a thread only sets the reference. */
+		slot->cycles_ref = rt_stats.execution_cycles;
+		slot->seen = true;
+	}
+}
+
+static void threads_window_process(bool first)
+{
+	k_thread_runtime_stats_t all;
+	struct thread_window window = {
+		.first = first,
+	};
+
+	if (k_thread_runtime_stats_all_get(&all)) {
+		return;
+	}
+
+	window.total = all.execution_cycles - total_cycles_ref;
+	total_cycles_ref = all.execution_cycles;
+
+	k_thread_foreach_unlocked(thread_window_cb, &window);
+
+	/* Release slots of the threads that no longer exist. */
+	K_SPINLOCK(&stats_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(threads); i++) {
+			if (!threads[i].seen) {
+				threads[i].thread = NULL;
+			}
+			threads[i].seen = false;
+		}
+	}
+}
+
+#ifdef CONFIG_NRF_CPU_LOAD_STATS_IRQ
+/* Nesting depth up to which interrupts are measured. */
+#define ISR_NEST_MAX 8
+#define IRQ_INVALID UINT16_MAX
+
+struct irq_acc {
+	uint32_t cycles;
+	uint32_t max_cycles;
+	uint32_t count;
+};
+
+struct isr_frame {
+	uint16_t irq;
+	uint32_t start;
+	uint32_t nested;
+};
+
+struct irq_slot {
+	uint16_t irq;
+	uint32_t count;
+	uint32_t isr_max_us;
+	struct load_hist hist;
+};
+
+/* Accumulated in the current window, written from the ISR hooks only. */
+static struct irq_acc irq_accs[CONFIG_NUM_IRQS];
+static struct isr_frame isr_stack[ISR_NEST_MAX];
+static uint8_t isr_depth;
+static bool isr_ready;
+
+static struct irq_slot irqs[CONFIG_NRF_CPU_LOAD_STATS_IRQS];
+static uint32_t irq_window_cycles_ref;
+static uint32_t irq_window_time_ref;
+
+static struct irq_slot *irq_slot_get(uint16_t irq)
+{
+	struct irq_slot *free_slot = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(irqs); i++) {
+		if (irqs[i].irq == irq) {
+			return &irqs[i];
+		}
+		if (!free_slot && (irqs[i].irq == IRQ_INVALID)) {
+			free_slot = &irqs[i];
+		}
+	}
+
+	return free_slot;
+}
+
+void sys_trace_isr_enter_user(int nested_interrupts)
+{
+	ARG_UNUSED(nested_interrupts);
+
+	if (!isr_ready) {
+		return;
+	}
+
+	unsigned int key = irq_lock();
+	int irq = (int)(__get_IPSR() & IPSR_ISR_Msk) - 16;
+
+	if (isr_depth < ISR_NEST_MAX) {
+		struct isr_frame *frame = &isr_stack[isr_depth];
+
+		frame->irq = ((irq >= 0) && (irq < CONFIG_NUM_IRQS)) ? irq : IRQ_INVALID;
+		frame->nested = 0;
+		frame->start = z_arm_dwt_get_cycles();
+	}
+	isr_depth++;
+
+	irq_unlock(key);
+}
+
+void sys_trace_isr_exit_user(int nested_interrupts)
+{
+	ARG_UNUSED(nested_interrupts);
+
+	if (!isr_ready) {
+		return;
+	}
+
+	unsigned int key = irq_lock();
+
+	if (isr_depth == 0) {
+		/* Interrupt entered before the measurement was started. */
+		irq_unlock(key);
+		return;
+	}
+
+	isr_depth--;
+	if (isr_depth < ISR_NEST_MAX) {
+		struct isr_frame *frame = &isr_stack[isr_depth];
+		uint32_t elapsed = z_arm_dwt_get_cycles() - frame->start;
+
+		if (frame->irq != IRQ_INVALID) {
+			struct irq_acc *acc = &irq_accs[frame->irq];
+			uint32_t own = elapsed - frame->nested;
+
+			acc->cycles += own;
+			acc->max_cycles = MAX(acc->max_cycles, own);
+			acc->count++;
+		}
+
+		/* Time of a nested interrupt is not counted to the preempted one. */
+		if (isr_depth > 0) {
+			isr_stack[isr_depth - 1].nested += elapsed;
+		}
+	}
+
+	irq_unlock(key);
+}
+
+static void irqs_window_process(bool first)
+{
+	uint32_t now_cycles = z_arm_dwt_get_cycles();
+	uint32_t now_time = k_cycle_get_32();
+	uint32_t window_cycles = now_cycles - irq_window_cycles_ref;
+	uint32_t window_us = k_cyc_to_us_floor32(now_time - irq_window_time_ref);
+
+	irq_window_cycles_ref = now_cycles;
+	irq_window_time_ref = now_time;
+
+	for (size_t irq = 0; irq < ARRAY_SIZE(irq_accs); irq++) {
+		struct irq_acc acc;
+		struct irq_slot *slot;
+
+		unsigned int key = irq_lock();
+
+		acc = irq_accs[irq];
+		memset(&irq_accs[irq], 0, sizeof(irq_accs[irq]));
+		irq_unlock(key);
+
+		if (first) {
+			continue;
+		}
+
+		K_SPINLOCK(&stats_lock) {
+			slot = irq_slot_get(irq);
+			if (!slot || ((slot->irq == IRQ_INVALID) && (acc.count == 0))) {
+				/* Interrupts are tracked once they are first seen. */
+				K_SPINLOCK_BREAK;
+			}
+
+			if (slot->irq == IRQ_INVALID) {
+				memset(slot, 0, sizeof(*slot));
+				slot->irq = irq;
+			}
+
+			slot->count += acc.count;
+			if (window_cycles > 0) {
+				slot->isr_max_us = MAX(slot->isr_max_us,
+						       (uint32_t)(((uint64_t)acc.max_cycles * window_us) /
+								  window_cycles));
+			}
+			hist_add(&slot->hist, load_calc(acc.cycles, window_cycles));
+		}
+	}
+}
+
+static void irqs_reset(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(irqs); i++) {
+		irqs[i].irq = IRQ_INVALID;
+	}
+}
+
+static int irqs_init(void)
+{
+	int err = z_arm_dwt_init();
+
+	if (err) {
+		LOG_ERR("Cycle counter not available");
+		return err;
+	}
+
+	z_arm_dwt_init_cycle_counter();
+	irqs_reset();
+	isr_ready = true;
+
+	return 0;
+}
+
+int cpu_load_irq_stats_get(size_t idx, struct cpu_load_irq_stats *stats)
+{
+	int ret = -ENOENT;
+
+	K_SPINLOCK(&stats_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(irqs); i++) {
+			if (irqs[i].irq == IRQ_INVALID) {
+				continue;
+			}
+			if (idx-- == 0) {
+				stats->irq = irqs[i].irq;
+				stats->count = irqs[i].count;
+				stats->isr_max_us = irqs[i].isr_max_us;
+				hist_dist_get(&irqs[i].hist, &stats->load);
+				ret = 0;
+				break;
+			}
+		}
+	}
+
+	return ret;
+}
+#else
+static void irqs_window_process(bool first)
+{
+	ARG_UNUSED(first);
+}
+
+static void irqs_reset(void)
+{
+}
+
+static int irqs_init(void)
+{
+	return 0;
+}
+#endif /* CONFIG_NRF_CPU_LOAD_STATS_IRQ */
+
+static void window_work_fn(struct k_work *work)
+{
+	static bool first = true;
+
+	threads_window_process(first);
+	irqs_window_process(first);
+	first = false;
+
+	k_work_reschedule(&window_work, K_MSEC(CONFIG_NRF_CPU_LOAD_STATS_WINDOW));
+}
+
+int cpu_load_thread_stats_get(size_t idx, struct cpu_load_thread_stats *stats)
+{
+	int ret = -ENOENT;
+
+	K_SPINLOCK(&stats_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(threads); i++) {
+			if (!threads[i].thread) {
+				continue;
+			}
+			if (idx-- == 0) {
+				stats->thread = threads[i].thread;
+				hist_dist_get(&threads[i].hist, &stats->load);
+				ret = 0;
+				break;
+			}
+		}
+	}
+
+	return ret;
+}
+
+void cpu_load_stats_reset(void)
+{
+	K_SPINLOCK(&stats_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(threads); i++) {
+			memset(&threads[i].hist, 0, sizeof(threads[i].hist));
+		}
+		irqs_reset();
+	}
+}
+
+static int cpu_load_stats_init(void)
+{
+	int err = irqs_init();
+
+	if (err) {
+		return err;
+	}
+
+	k_work_init_delayable(&window_work, window_work_fn);
+	k_work_schedule(&window_work, K_NO_WAIT);
+
+	return 0;
+}
+
+SYS_INIT(cpu_load_stats_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -274,11 +274,40 @@ static struct esb_payload *current_payload;
 static struct payload_tx_fifo tx_fifo;
 static struct payload_rx_fifo rx_fifo;
 
-static uint8_t tx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
-				 sizeof(struct esb_radio_pdu)];
+/* With TX preloading, the PDU of the next packet in the TX FIFO is prepared
+ * into the second buffer while the current packet is in flight.
+ */
+#define TX_PDU_BUF_COUNT (IS_ENABLED(CONFIG_ESB_TX_PRELOAD) ? 2 : 1)
+
+static uint8_t tx_payload_buffer[TX_PDU_BUF_COUNT][CONFIG_ESB_MAX_PAYLOAD_LENGTH +
+						   sizeof(struct esb_radio_pdu)];
 static uint8_t rx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
 				 sizeof(struct esb_radio_pdu)];
 
+/* Buffer the radio receives packets into. In zero-copy mode, this is the
+ * RX FIFO slot the next received packet is pushed to.
+ */
+static uint8_t *rx_dma_buf = rx_payload_buffer;
+
+/* Buffer the radio transmits packets from. */
+static uint8_t *tx_dma_buf = tx_payload_buffer[0];
+
+/* TX FIFO element whose PDU is prepared in the spare TX buffer, or NULL. */
+static const struct esb_payload *tx_preloaded_payload;
+
+#if defined(CONFIG_ESB_RX_ZERO_COPY)
+/* In zero-copy mode, the radio PDU header is received into the bytes preceding
+ * the payload data of an RX FIFO slot, so it must not overlap the fields that
+ * are filled in when the packet is pushed.
+ */
+BUILD_ASSERT(offsetof(struct esb_payload, data) >=
+	     offsetof(struct esb_payload, rssi) + sizeof(int8_t) + sizeof(struct esb_radio_pdu),
+	     "No room for the radio PDU header in struct esb_payload");
+
+#define RX_SLOT_PDU(_payload) \
+	((struct esb_radio_pdu *)((_payload)->data - sizeof(struct esb_radio_pdu)))
+#endif /* defined(CONFIG_ESB_RX_ZERO_COPY) */
+
 /* Random access buffer variables for ACK payload handling */
 struct payload_wrap ack_pl_wrap[CONFIG_ESB_TX_FIFO_SIZE];
 struct payload_wrap *ack_pl_wrap_pipe[CONFIG_ESB_PIPE_COUNT];
@@ -291,6 +320,10 @@ static volatile uint32_t retransmits_remaining;
 static volatile uint32_t last_tx_attempts;
 static volatile uint32_t wait_for_ack_timeout_us;
 
+#if defined(CONFIG_ESB_PIPE_STATS)
+static struct esb_pipe_stats pipe_stats[CONFIG_ESB_PIPE_COUNT];
+#endif /* defined(CONFIG_ESB_PIPE_STATS) */
+
 static const bool fast_switching = IS_ENABLED(CONFIG_ESB_FAST_SWITCHING);
 
 static mpsl_fem_event_t rx_event = {
@@ -1187,6 +1220,7 @@ static void reset_fifos(void)
 	tx_fifo.back = 0;
 	tx_fifo.front = 0;
 	atomic_clear(&tx_fifo.count);
+	tx_preloaded_payload = NULL;
 
 	rx_fifo.back = 0;
 	rx_fifo.front = 0;
@@ -1232,11 +1266,75 @@ static void tx_fifo_remove_first(void)
 	atomic_dec(&tx_fifo.count);
 }
 
+static void pipe_stats_tx_update(uint8_t pipe, uint8_t length, uint32_t attempts, bool success)
+{
+#if defined(CONFIG_ESB_PIPE_STATS)
+	struct esb_pipe_stats *stats;
+
+	if (pipe >= CONFIG_ESB_PIPE_COUNT) {
+		return;
+	}
+
+	stats = &pipe_stats[pipe];
+	if (success) {
+		stats->tx_packets++;
+		stats->tx_bytes += length;
+	} else {
+		stats->tx_failed++;
+	}
+	stats->tx_retransmits += attempts - 1;
+#else
+	ARG_UNUSED(pipe);
+	ARG_UNUSED(length);
+	ARG_UNUSED(attempts);
+	ARG_UNUSED(success);
+#endif /* defined(CONFIG_ESB_PIPE_STATS) */
+}
+
+static void pipe_stats_rx_update(uint8_t pipe, uint8_t length)
+{
+#if defined(CONFIG_ESB_PIPE_STATS)
+	if (pipe >= CONFIG_ESB_PIPE_COUNT) {
+		return;
+	}
+
+	pipe_stats[pipe].rx_packets++;
+	pipe_stats[pipe].rx_bytes += length;
+#else
+	ARG_UNUSED(pipe);
+	ARG_UNUSED(length);
+#endif /* defined(CONFIG_ESB_PIPE_STATS) */
+}
+
+/*  Function to get the buffer for receiving the next packet.
+ *
+ *  In zero-copy mode, the radio receives the packet directly into the next free
+ *  RX FIFO slot. If the RX FIFO is full, or in monitor mode where the radio
+ *  restarts reception before the received packet is processed, the packet is
+ *  received into rx_payload_buffer and copied when it is pushed.
+ *
+ *  @return Buffer to set to the register NRF_RADIO->PACKETPTR.
+ */
+static uint8_t *rx_buf_get(void)
+{
+#if defined(CONFIG_ESB_RX_ZERO_COPY)
+	if ((atomic_get(&rx_fifo.count) < CONFIG_ESB_RX_FIFO_SIZE) &&
+	    (esb_cfg.mode != ESB_MODE_MONITOR)) {
+		rx_dma_buf = (uint8_t *)RX_SLOT_PDU(rx_fifo.payload[rx_fifo.back]);
+	} else {
+		rx_dma_buf = rx_payload_buffer;
+	}
+#endif /* defined(CONFIG_ESB_RX_ZERO_COPY) */
+
+	return rx_dma_buf;
+}
+
 /*  Function to push the content of the rx_buffer to the RX FIFO.
  *
  *  The module will point the register NRF_RADIO->PACKETPTR to a buffer for
  *  receiving packets. After receiving a packet the module will call this
- *  function to copy the received data to the RX FIFO.
+ *  function to copy the received data to the RX FIFO. In zero-copy mode, the
+ *  data is only copied if it was not received directly into the RX FIFO.
  *
  *  @param  pipe Pipe number to set for the packet.
  *  @param  pid  Packet ID.
@@ -1246,32 +1344,50 @@ static void tx_fifo_remove_first(void)
  */
 static bool rx_fifo_push_rfbuf(uint8_t pipe, uint8_t pid)
 {
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_dma_buf;
+	struct esb_payload *payload;
+	uint8_t length;
 
 	if (atomic_get(&rx_fifo.count) >= CONFIG_ESB_RX_FIFO_SIZE) {
 		return false;
 	}
 
+	payload = rx_fifo.payload[rx_fifo.back];
+
 	if (esb_cfg.protocol == ESB_PROTOCOL_ESB_DPL) {
 		if (rx_pdu->type.dpl_pdu.length > CONFIG_ESB_MAX_PAYLOAD_LENGTH) {
 			return false;
 		}
 
-		rx_fifo.payload[rx_fifo.back]->length = rx_pdu->type.dpl_pdu.length;
+		length = rx_pdu->type.dpl_pdu.length;
 	} else if (esb_cfg.mode == ESB_MODE_PTX) {
 		/* Received packet is an acknowledgment */
-		rx_fifo.payload[rx_fifo.back]->length = 0;
+		length = 0;
 	} else {
-		rx_fifo.payload[rx_fifo.back]->length = esb_cfg.payload_length;
+		length = esb_cfg.payload_length;
 	}
 
-	memcpy(rx_fifo.payload[rx_fifo.back]->data, rx_pdu->data,
-	       rx_fifo.payload[rx_fifo.back]->length);
+#if defined(CONFIG_ESB_RX_ZERO_COPY)
+	/* The PDU header is kept in the slot, and the PID and the no-ACK flag are
+	 * decoded from it when the payload is read.
+	 */
+	ARG_UNUSED(pid);
+
+	if (rx_pdu != RX_SLOT_PDU(payload)) {
+		memcpy(RX_SLOT_PDU(payload), rx_pdu, sizeof(struct esb_radio_pdu) + length);
+	}
+#else
+	memcpy(payload->data, rx_pdu->data, length);
 
-	rx_fifo.payload[rx_fifo.back]->pipe = pipe;
-	rx_fifo.payload[rx_fifo.back]->rssi = nrf_radio_rssi_sample_get(NRF_RADIO);
-	rx_fifo.payload[rx_fifo.back]->pid = pid;
-	rx_fifo.payload[rx_fifo.back]->noack = !rx_pdu->type.dpl_pdu.ack;
+	payload->pid = pid;
+	payload->noack = !rx_pdu->type.dpl_pdu.ack;
+#endif /* defined(CONFIG_ESB_RX_ZERO_COPY) */
+
+	payload->length = length;
+	payload->pipe = pipe;
+	payload->rssi = nrf_radio_rssi_sample_get(NRF_RADIO);
+
+	pipe_stats_rx_update(pipe, length);
 
 	if (++rx_fifo.back >= CONFIG_ESB_RX_FIFO_SIZE) {
 		rx_fifo.back = 0;
@@ -1403,23 +1519,92 @@ static void sys_timer_deinit(void)
 	nrfx_timer_uninit(&esb_timer);
 }
 
+/*  Function to encode a TX FIFO element into a radio PDU.
+ *
+ *  @param  buf      Buffer to encode the PDU into.
+ *  @param  payload  TX FIFO element to encode.
+ */
+static void tx_pdu_encode(uint8_t *buf, const struct esb_payload *payload)
+{
+	struct esb_radio_pdu *pdu = (struct esb_radio_pdu *)buf;
+
+	if (esb_cfg.protocol == ESB_PROTOCOL_ESB_DPL) {
+		memset(&pdu->type.dpl_pdu, 0, sizeof(pdu->type.dpl_pdu));
+		pdu->type.dpl_pdu.length = payload->length;
+		pdu->type.dpl_pdu.pid = payload->pid;
+		/* nRF24L01 chip inverts ACK bit */
+		pdu->type.dpl_pdu.ack = !payload->noack;
+	} else {
+		memset(&pdu->type.fixed_pdu, 0, sizeof(pdu->type.fixed_pdu));
+		pdu->type.fixed_pdu.pid = payload->pid;
+	}
+
+	memcpy(pdu->data, payload->data, payload->length);
+}
+
+/*  Function to get the PDU for transmitting the first element of the TX FIFO.
+ *
+ *  If the PDU of the element was preloaded while the previous packet was in
+ *  flight, the buffers are swapped. Otherwise, the element is encoded now.
+ *
+ *  @return Buffer to set to the register NRF_RADIO->PACKETPTR.
+ */
+static uint8_t *tx_buf_get(void)
+{
+#if defined(CONFIG_ESB_TX_PRELOAD)
+	if ((tx_preloaded_payload != NULL) && (tx_preloaded_payload == current_payload)) {
+		tx_preloaded_payload = NULL;
+		tx_dma_buf = (tx_dma_buf == tx_payload_buffer[0]) ? tx_payload_buffer[1] :
+								     tx_payload_buffer[0];
+		return tx_dma_buf;
+	}
+	tx_preloaded_payload = NULL;
+#endif /* defined(CONFIG_ESB_TX_PRELOAD) */
+
+	tx_pdu_encode(tx_dma_buf, current_payload);
+
+	return tx_dma_buf;
+}
+
+/*  Function to prepare the PDU of the second element of the TX FIFO into the
+ *  spare TX buffer, so that it can be started as soon as the current
+ *  transaction completes.
+ */
+static void tx_preload_next(void)
+{
+#if defined(CONFIG_ESB_TX_PRELOAD)
+	uint32_t next;
+
+	if ((atomic_get(&tx_fifo.count) < 2) || (esb_cfg.tx_mode == ESB_TXMODE_MANUAL)) {
+		return;
+	}
+
+	next = tx_fifo.front + 1;
+	if (next >= CONFIG_ESB_TX_FIFO_SIZE) {
+		next = 0;
+	}
+
+	tx_pdu_encode((tx_dma_buf == tx_payload_buffer[0]) ? tx_payload_buffer[1] :
+							      tx_payload_buffer[0],
+		      tx_fifo.payload[next]);
+	tx_preloaded_payload = tx_fifo.payload[next];
+#endif /* defined(CONFIG_ESB_TX_PRELOAD) */
+}
+
 static void start_tx_transaction(void)
 {
 	bool ack = true;
 	bool is_tx_idle = false;
-	struct esb_radio_pdu *pdu = (struct esb_radio_pdu *)tx_payload_buffer;
+	uint8_t *pdu;
+
 	/* Prepare the payload */
 	current_payload = tx_fifo.payload[tx_fifo.front];
+	pdu = tx_buf_get();
 
 	switch (esb_cfg.protocol) {
 	case ESB_PROTOCOL_ESB:
-		memset(&pdu->type.fixed_pdu, 0, sizeof(pdu->type.fixed_pdu));
 		update_rf_payload_format_esb(esb_cfg.payload_length);
 
-		pdu->type.fixed_pdu.pid = current_payload->pid;
-
-		memcpy(pdu->data, current_payload->data, current_payload->length);
-
 		if (fast_switching) {
 			nrf_radio_shorts_set(NRF_RADIO, (RADIO_RSSI_SHORTS |
 							 NRF_RADIO_SHORT_TXREADY_START_MASK));
@@ -1439,14 +1624,7 @@ static void start_tx_transaction(void)
 		break;
 
 	case ESB_PROTOCOL_ESB_DPL:
-		memset(&pdu->type.dpl_pdu, 0, sizeof(pdu->type.dpl_pdu));
 		ack = !current_payload->noack || !esb_cfg.selective_auto_ack;
-		pdu->type.dpl_pdu.length = current_payload->length;
-		pdu->type.dpl_pdu.pid = current_payload->pid;
-		/* nRF24L01 chip inverts ACK bit */
-		pdu->type.dpl_pdu.ack = !current_payload->noack;
-
-		memcpy(pdu->data, current_payload->data, current_payload->length);
 
 		/* Handling ack if noack is set to false or if selective auto ack is turned off */
 		if (ack) {
@@ -1530,6 +1708,9 @@ static void start_tx_transaction(void)
 
 		radio_start();
 	}
+
+	/* The next packet is prepared while this one is on air */
+	tx_preload_next();
 }
 
 static void set_evt_interrupt(void)
@@ -1549,6 +1730,7 @@ static void on_timer_compare1_tx_noack(void)
 
 	last_tx_attempts = 1;
 	atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
+	pipe_stats_tx_update(current_payload->pipe, current_payload->length, 1, true);
 	tx_fifo_remove_first();
 
 	if (atomic_get(&tx_fifo.count) == 0) {
@@ -1567,6 +1749,7 @@ static void on_radio_disabled_tx_noack(void)
 
 	last_tx_attempts = 1;
 	atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
+	pipe_stats_tx_update(current_payload->pipe, current_payload->length, 1, true);
 	tx_fifo_remove_first();
 
 	if (!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT)) {
@@ -1650,7 +1833,7 @@ static void on_radio_disabled_tx(void)
 		update_rf_payload_format_esb(0);
 	}
 
-	nrf_radio_packetptr_set(NRF_RADIO, rx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, rx_buf_get());
 	if (fast_switching) {
 		nrf_radio_int_disable(NRF_RADIO, ESB_RADIO_INT_END_MASK);
 		nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_START);
@@ -1677,7 +1860,7 @@ static void continue_retx(void)
 		update_rf_payload_format_esb(esb_cfg.payload_length);
 	}
 
-	nrf_radio_packetptr_set(NRF_RADIO, tx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, tx_dma_buf);
 
 	on_radio_disabled = on_radio_disabled_tx;
 	esb_state = ESB_STATE_PTX_TX_ACK;
@@ -1784,7 +1967,7 @@ static void schedule_retx_in_timeslot(void)
 
 static void on_radio_disabled_tx_wait_for_ack(void)
 {
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_dma_buf;
 	/* This marks the completion of a TX_RX sequence (TX with ACK) */
 
 	/* Make sure the timer will not deactivate the radio if a packet is
@@ -1801,6 +1984,8 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 	    nrf_radio_crc_status_check(NRF_RADIO)) {
 		atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
 		last_tx_attempts = esb_cfg.retransmit_count - retransmits_remaining + 1;
+		pipe_stats_tx_update(current_payload->pipe, current_payload->length,
+				     last_tx_attempts, true);
 
 		tx_fifo_remove_first();
 
@@ -1855,6 +2040,8 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 
 		last_tx_attempts = esb_cfg.retransmit_count + 1;
 		atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_FAILED);
+		pipe_stats_tx_update(current_payload->pipe, current_payload->length,
+				     last_tx_attempts, false);
 
 		esb_state = ESB_STATE_IDLE;
 		errata_216_off();
@@ -1911,7 +2098,7 @@ static void start_retx_in_new_timeslot(void)
 
 	update_radio_tx_power();
 
-	nrf_radio_packetptr_set(NRF_RADIO, tx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, tx_dma_buf);
 
 	NVIC_ClearPendingIRQ(ESB_RADIO_IRQ_NUMBER);
 	irq_enable(ESB_RADIO_IRQ_NUMBER);
@@ -1953,7 +2140,7 @@ static void start_rx_listening(void)
 	nrf_radio_rxaddresses_set(NRF_RADIO, esb_addr.rx_pipes_enabled);
 	nrf_radio_frequency_set(NRF_RADIO, (RADIO_BASE_FREQUENCY + esb_addr.rf_channel));
 	atomic_clear_bit(&esb_addr.rf_channel_flags, RF_CHANNEL_UPDATE_FLAG);
-	nrf_radio_packetptr_set(NRF_RADIO, rx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, rx_buf_get());
 
 	NVIC_ClearPendingIRQ(ESB_RADIO_IRQ_NUMBER);
 	irq_enable(ESB_RADIO_IRQ_NUMBER);
@@ -1979,7 +2166,7 @@ static void clear_events_restart_rx(void)
 		update_rf_payload_format_esb(esb_cfg.payload_length);
 	}
 
-	nrf_radio_packetptr_set(NRF_RADIO, rx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, rx_buf_get());
 
 	nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_DISABLED);
 	nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
@@ -2006,8 +2193,8 @@ static void clear_events_restart_rx(void)
 
 static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_info)
 {
-	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_payload_buffer;
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_dma_buf;
+	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_dma_buf;
 
 	uint32_t pipe = nrf_radio_rxmatch_get(NRF_RADIO);
 
@@ -2017,6 +2204,7 @@ static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_
 		/* Pipe stays in ACK with payload until TX FIFO is empty */
 		/* Do not report TX success on first ack payload or retransmit */
 		if (pipe_info->ack_payload == true && !retransmit_payload) {
+			pipe_stats_tx_update(pipe, current_payload->length, 1, true);
 			ack_pl_wrap_pipe[pipe]->in_use = false;
 			ack_pl_wrap_pipe[pipe] = ack_pl_wrap_pipe[pipe]->p_next;
 			atomic_dec(&tx_fifo.count);
@@ -2053,9 +2241,10 @@ static void on_radio_disabled_rx(void)
 {
 	bool retransmit_payload = false;
 	bool send_rx_event = true;
+	bool rx_pushed = false;
 	struct pipe_info *pipe_info;
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
-	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_payload_buffer;
+	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_dma_buf;
+	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_dma_buf;
 
 	if (!nrf_radio_crc_status_check(NRF_RADIO)) {
 		clear_events_restart_rx();
@@ -2078,6 +2267,14 @@ static void on_radio_disabled_rx(void)
 	pipe_info->pid = rx_pdu->type.dpl_pdu.pid;
 	pipe_info->crc = nrf_radio_rxcrc_get(NRF_RADIO);
 
+	/* In zero-copy mode, the packet is pushed before the radio is restarted so
+	 * that the next packet is received into the next free RX FIFO slot. The PDU
+	 * header stays intact in the slot for preparing the ACK.
+	 */
+	if (IS_ENABLED(CONFIG_ESB_RX_ZERO_COPY) && send_rx_event) {
+		rx_pushed = rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO), pipe_info->pid);
+	}
+
 	/* Check if an ack should be sent */
 	if ((esb_cfg.selective_auto_ack == false) || rx_pdu->type.dpl_pdu.ack) {
 		esb_fem_for_tx_ack();
@@ -2117,15 +2314,15 @@ static void on_radio_disabled_rx(void)
 		clear_events_restart_rx();
 	}
 
-	if (send_rx_event) {
-		/* Push the new packet to the RX buffer and trigger a received
-		 * event if the operation was
-		 * successful.
-		 */
-		if (rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO), pipe_info->pid)) {
-			atomic_set_bit(&interrupt_flags, ESB_EVENT_RX_RECEIVED);
-			set_evt_interrupt();
-		}
+	if (!IS_ENABLED(CONFIG_ESB_RX_ZERO_COPY) && send_rx_event) {
+		/* Push the new packet to the RX buffer. */
+		rx_pushed = rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO), pipe_info->pid);
+	}
+
+	/* Trigger a received event if the push operation was successful. */
+	if (rx_pushed) {
+		atomic_set_bit(&interrupt_flags, ESB_EVENT_RX_RECEIVED);
+		set_evt_interrupt();
 	}
 }
 
@@ -2137,7 +2334,7 @@ static void on_radio_disabled_rx_send_ack(void)
 		update_rf_payload_format_esb(esb_cfg.payload_length);
 	}
 
-	nrf_radio_packetptr_set(NRF_RADIO, rx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, rx_buf_get());
 	if (fast_switching) {
 		nrf_radio_shorts_set(NRF_RADIO,
 				     (RADIO_RSSI_SHORTS | NRF_RADIO_SHORT_RXREADY_START_MASK));
@@ -2154,7 +2351,7 @@ static void on_radio_disabled_rx_send_ack(void)
 static void on_radio_end_monitor(void)
 {
 	struct pipe_info pipe;
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_dma_buf;
 
 	pipe.pid = rx_pdu->type.dpl_pdu.pid;
 	if (rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO), pipe.pid)) {
@@ -2720,8 +2917,13 @@ int esb_read_rx_payload(struct esb_payload *payload)
 	payload->length = rx_fifo.payload[rx_fifo.front]->length;
 	payload->pipe = rx_fifo.payload[rx_fifo.front]->pipe;
 	payload->rssi = rx_fifo.payload[rx_fifo.front]->rssi;
+#if defined(CONFIG_ESB_RX_ZERO_COPY)
+	payload->pid = RX_SLOT_PDU(rx_fifo.payload[rx_fifo.front])->type.dpl_pdu.pid;
+	payload->noack = !RX_SLOT_PDU(rx_fifo.payload[rx_fifo.front])->type.dpl_pdu.ack;
+#else
 	payload->pid = rx_fifo.payload[rx_fifo.front]->pid;
 	payload->noack = rx_fifo.payload[rx_fifo.front]->noack;
+#endif /* defined(CONFIG_ESB_RX_ZERO_COPY) */
 	memcpy(payload->data, rx_fifo.payload[rx_fifo.front]->data,
 	       payload->length);
 
@@ -2805,6 +3007,7 @@ int esb_flush_tx(void)
 	atomic_clear(&tx_fifo.count);
 	tx_fifo.back = 0;
 	tx_fifo.front = 0;
+	tx_preloaded_payload = NULL;
 
 	for (size_t i = 0; i < CONFIG_ESB_TX_FIFO_SIZE; i++) {
 		ack_pl_wrap[i].in_use = false;
@@ -2831,6 +3034,7 @@ int esb_pop_tx(void)
 	}
 
 	tx_fifo_remove_first();
+	tx_preloaded_payload = NULL;
 
 	return 0;
 }
@@ -3078,6 +3282,38 @@ int esb_reuse_pid(uint8_t pipe)
 	return 0;
 }
 
+#if defined(CONFIG_ESB_PIPE_STATS)
+int esb_get_pipe_stats(uint8_t pipe, struct esb_pipe_stats *stats)
+{
+	unsigned int key;
+
+	if (!(pipe < CONFIG_ESB_PIPE_COUNT) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	*stats = pipe_stats[pipe];
+	irq_unlock(key);
+
+	return 0;
+}
+
+int esb_reset_pipe_stats(uint8_t pipe)
+{
+	unsigned int key;
+
+	if (!(pipe < CONFIG_ESB_PIPE_COUNT)) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	memset(&pipe_stats[pipe], 0, sizeof(pipe_stats[pipe]));
+	irq_unlock(key);
+
+	return 0;
+}
+#endif /* defined(CONFIG_ESB_PIPE_STATS) */
+
 static mpsl_timeslot_signal_return_param_t *ts_start_action(void)
 {
 	nrf_radio_mode_set(NRF_RADIO, (nrf_radio_mode_t)esb_cfg.bitrate);
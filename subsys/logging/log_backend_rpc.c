@@ -20,6 +20,8 @@
 
 #include <zephyr/debug/coredump.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/cbprintf.h>
 #include <zephyr/sys_clock.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_backend.h>
@@ -120,6 +122,32 @@ static K_THREAD_STACK_DEFINE(history_transfer_workq_stack,
 static struct k_work_q history_transfer_workq;
 #endif
 
+#ifdef CONFIG_LOG_BACKEND_RPC_DICTIONARY
+static struct {
+	/* One buffer collects messages while the other one is being sent. */
+	uint8_t bufs[2][CONFIG_LOG_BACKEND_RPC_DICTIONARY_BATCH_SIZE];
+	uint8_t *buf;
+	size_t len;
+	uint64_t last_timestamp_us;
+	const uint8_t *tx_buf;
+	size_t tx_len;
+	/* Strings currently assigned to the dictionary slots on the remote side. */
+	const char *fmt_slots[CONFIG_LOG_RPC_DICTIONARY_FMT_SLOTS];
+	const char *src_slots[CONFIG_LOG_RPC_DICTIONARY_SRC_SLOTS];
+} dict = {
+	.buf = dict.bufs[0],
+};
+static atomic_t dict_invalidated;
+static K_MUTEX_DEFINE(dict_mtx);
+static K_SEM_DEFINE(dict_tx_sem, 1, 1);
+static void dict_send_task(struct k_work *work);
+static void dict_flush_task(struct k_work *work);
+static K_WORK_DEFINE(dict_send_work, dict_send_task);
+static K_WORK_DELAYABLE_DEFINE(dict_flush_work, dict_flush_task);
+static K_THREAD_STACK_DEFINE(dict_workq_stack, CONFIG_LOG_BACKEND_RPC_DICTIONARY_THREAD_STACK_SIZE);
+static struct k_work_q dict_workq;
+#endif
+
 /*
  * Verify that Zephyr logging level can be used as the nRF RPC logging level without translation.
  */
@@ -481,6 +509,7 @@ static size_t format_message_to_buf(struct log_msg *msg, uint32_t flags, uint8_t
 	return output_ctx.total_len;
 }
 
+#ifndef CONFIG_LOG_BACKEND_RPC_DICTIONARY
 static void stream_message(struct log_msg *msg)
 {
 	const uint32_t flags = common_output_flags | LOG_OUTPUT_FLAG_CRLF_NONE;
@@ -505,6 +534,7 @@ static void stream_message(struct log_msg *msg)
 
 	nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG, &ctx);
 }
+#endif
 
 static const char *log_msg_source_name_get(struct log_msg *msg)
 {
@@ -560,6 +590,284 @@ static bool should_filter_out(struct log_msg *msg)
 	return false;
 }
 
+#ifdef CONFIG_LOG_BACKEND_RPC_DICTIONARY
+
+static void dict_send_task(struct k_work *work)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	int err;
+
+	ARG_UNUSED(work);
+
+	NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, 5 + dict.tx_len);
+	nrf_rpc_encode_buffer(&ctx, dict.tx_buf, dict.tx_len);
+	err = nrf_rpc_cbor_evt(&log_rpc_group, LOG_RPC_EVT_MSG_BATCH, &ctx);
+
+	if (err) {
+		/* The lost batch may have defined strings, so define all of them again. */
+		atomic_set(&dict_invalidated, 1);
+	}
+
+	k_sem_give(&dict_tx_sem);
+}
+
+/*
+ * Passes the pending batch of messages to the dictionary work queue for sending, and
+ * continues collecting messages in the other buffer. Must be called with dict_mtx locked.
+ */
+static int dict_batch_queue(k_timeout_t timeout)
+{
+	int err;
+
+	if (dict.len == 0) {
+		return 0;
+	}
+
+	err = k_sem_take(&dict_tx_sem, timeout);
+
+	if (err) {
+		return err;
+	}
+
+	dict.tx_buf = dict.buf;
+	dict.tx_len = dict.len;
+	dict.buf = (dict.buf == dict.bufs[0]) ? dict.bufs[1] : dict.bufs[0];
+	dict.len = 0;
+	dict.last_timestamp_us = 0;
+
+	k_work_submit_to_queue(&dict_workq, &dict_send_work);
+
+	return 0;
+}
+
+static void dict_flush_task(struct k_work *work)
+{
+	int err = -EBUSY;
+
+	ARG_UNUSED(work);
+
+	/*
+	 * Do not wait here: the logging thread may hold dict_mtx while it waits for the send
+	 * work queued behind this one. Try again shortly instead.
+	 */
+	if (k_mutex_lock(&dict_mtx, K_NO_WAIT) == 0) {
+		err = dict_batch_queue(K_NO_WAIT);
+		k_mutex_unlock(&dict_mtx);
+	}
+
+	if (err) {
+		k_work_reschedule_for_queue(&dict_workq, &dict_flush_work, K_MSEC(1));
+	}
+}
+
+/*
+ * Returns the dictionary slot of the string, and appends the slot definition to the batch
+ * if the slot is currently assigned to another string. The strings are identified by their
+ * address, as only constant strings are put in the dictionary.
+ */
+static uint8_t dict_define(uint8_t type, const char **slots, size_t slot_cnt, const char *str,
+			   size_t len)
+{
+	uint8_t slot = (((uint32_t)(uintptr_t)str * 2654435761U) >> 16) % slot_cnt;
+	uint8_t *out = &dict.buf[dict.len];
+
+	if (slots[slot] == str) {
+		return slot;
+	}
+
+	out[0] = type;
+	out[1] = slot;
+	out[2] = (uint8_t)len;
+	memcpy(&out[LOG_RPC_DICT_DEF_HDR_LEN], str, len);
+	dict.len += LOG_RPC_DICT_DEF_HDR_LEN + len;
+	slots[slot] = str;
+
+	return slot;
+}
+
+static int dict_package_append(const void *buf, size_t len, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	if (len > sizeof(dict.bufs[0]) - dict.len) {
+		return -ENOSPC;
+	}
+
+	if (len > 0) {
+		memcpy(&dict.buf[dict.len], buf, len);
+		dict.len += len;
+	}
+
+	return (int)len;
+}
+
+/*
+ * Removes the format string from the strings appended to the package.
+ * Returns the new package length, or 0 if the format string could not be removed.
+ */
+static size_t dict_fmt_strip(uint8_t *pkg, size_t len)
+{
+	union cbprintf_package_hdr hdr;
+	uint8_t *str;
+	size_t str_size;
+
+	memcpy(&hdr, pkg, sizeof(hdr));
+
+	if (hdr.desc.ro_str_cnt != 0 || hdr.desc.rw_str_cnt != 0) {
+		return 0;
+	}
+
+	str = pkg + hdr.desc.len * sizeof(int);
+
+	for (uint8_t i = 0; i < hdr.desc.str_cnt; i++) {
+		/* String index, string and null terminator */
+		str_size = strlen((const char *)&str[1]) + 2;
+
+		if (str[0] == LOG_RPC_DICT_FMT_IDX) {
+			memmove(str, str + str_size, pkg + len - (str + str_size));
+			hdr.desc.str_cnt--;
+			memcpy(pkg, &hdr, sizeof(hdr));
+
+			return len - str_size;
+		}
+
+		str += str_size;
+	}
+
+	return 0;
+}
+
+static void stream_message_dict(struct log_msg *msg)
+{
+	const uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RO_STR;
+	const char *source = log_msg_source_name_get(msg);
+	size_t source_len = 0;
+	const char *fmt;
+	size_t fmt_len;
+	uint8_t *pkg;
+	size_t pkg_len;
+	uint8_t *data;
+	size_t data_len;
+	uint8_t src_slot = LOG_RPC_DICT_SLOT_NONE;
+	uint8_t fmt_slot = LOG_RPC_DICT_SLOT_NONE;
+	size_t max_len;
+	size_t msg_start;
+	size_t pkg_start;
+	uint8_t *hdr;
+	uint64_t timestamp_us;
+	uint64_t last_timestamp_us;
+	int len;
+
+	pkg = log_msg_get_package(msg, &pkg_len);
+
+	if (pkg_len < sizeof(union cbprintf_package_hdr) + sizeof(fmt)) {
+		return;
+	}
+
+	memcpy(&fmt, pkg + sizeof(union cbprintf_package_hdr), sizeof(fmt));
+	fmt_len = strlen(fmt);
+
+	if (source != NULL) {
+		source_len = MIN(strlen(source), CONFIG_LOG_RPC_DICTIONARY_SRC_MAX_LEN);
+	}
+
+	data = log_msg_get_data(msg, &data_len);
+
+	/* 1. Calculate the self-contained package length to check if the message fits. */
+	len = cbprintf_package_convert(pkg, pkg_len, NULL, NULL, flags, NULL, 0);
+
+	if (len < 0) {
+		return;
+	}
+
+	max_len = 2 * LOG_RPC_DICT_DEF_HDR_LEN + CONFIG_LOG_RPC_DICTIONARY_SRC_MAX_LEN +
+		  CONFIG_LOG_RPC_DICTIONARY_FMT_MAX_LEN + LOG_RPC_DICT_MSG_HDR_MAX_LEN + len +
+		  data_len;
+
+	if (max_len > sizeof(dict.bufs[0])) {
+		/* The message would never fit in a batch. */
+		return;
+	}
+
+	k_mutex_lock(&dict_mtx, K_FOREVER);
+
+	if (atomic_cas(&dict_invalidated, 1, 0)) {
+		memset(dict.fmt_slots, 0, sizeof(dict.fmt_slots));
+		memset(dict.src_slots, 0, sizeof(dict.src_slots));
+	}
+
+	if (dict.len + max_len > sizeof(dict.bufs[0])) {
+		dict_batch_queue(K_FOREVER);
+	}
+
+	if (dict.len == 0) {
+		k_work_schedule_for_queue(&dict_workq, &dict_flush_work,
+					  K_MSEC(CONFIG_LOG_BACKEND_RPC_DICTIONARY_FLUSH_INTERVAL));
+	}
+
+	/* 2. Define the strings that the remote does not know yet. */
+	if (source != NULL) {
+		src_slot = dict_define(LOG_RPC_DICT_ENTRY_DEF_SRC, dict.src_slots,
+				       ARRAY_SIZE(dict.src_slots), source, source_len);
+	}
+
+	if (fmt_len <= CONFIG_LOG_RPC_DICTIONARY_FMT_MAX_LEN) {
+		fmt_slot = dict_define(LOG_RPC_DICT_ENTRY_DEF_FMT, dict.fmt_slots,
+				       ARRAY_SIZE(dict.fmt_slots), fmt, fmt_len);
+	}
+
+	/* 3. Encode the message header, the self-contained package and the hexdump data. */
+	msg_start = dict.len;
+	last_timestamp_us = dict.last_timestamp_us;
+	timestamp_us = log_output_timestamp_to_us(log_msg_get_timestamp(msg));
+
+	hdr = &dict.buf[dict.len];
+	hdr[0] = LOG_RPC_DICT_ENTRY_MSG;
+	hdr[1] = log_msg_get_level(msg);
+	hdr[2] = src_slot;
+	hdr[3] = fmt_slot;
+	dict.len += 4;
+	dict.len += log_rpc_dict_varint_encode(&dict.buf[dict.len],
+					       (int64_t)(timestamp_us - last_timestamp_us));
+	dict.len += sizeof(uint16_t);
+	pkg_start = dict.len;
+
+	len = cbprintf_package_convert(pkg, pkg_len, dict_package_append, NULL, flags, NULL, 0);
+
+	if (len < 0) {
+		dict.len = msg_start;
+		goto out;
+	}
+
+	pkg_len = dict.len - pkg_start;
+
+	/* 4. Replace the format string with the dictionary slot. */
+	if (fmt_slot != LOG_RPC_DICT_SLOT_NONE) {
+		len = dict_fmt_strip(&dict.buf[pkg_start], pkg_len);
+
+		if (len > 0) {
+			pkg_len = len;
+		} else {
+			hdr[3] = LOG_RPC_DICT_SLOT_NONE;
+		}
+	}
+
+	sys_put_le16(pkg_len, &dict.buf[pkg_start - sizeof(uint16_t)]);
+	dict.len = pkg_start + pkg_len;
+
+	sys_put_le16(data_len, &dict.buf[dict.len]);
+	dict.len += sizeof(uint16_t);
+	memcpy(&dict.buf[dict.len], data, data_len);
+	dict.len += data_len;
+
+	dict.last_timestamp_us = timestamp_us;
+
+out:
+	k_mutex_unlock(&dict_mtx);
+}
+
+#endif /* CONFIG_LOG_BACKEND_RPC_DICTIONARY */
+
 static void process(const struct log_backend *const backend, union log_msg_generic *msg_generic)
 {
 	struct log_msg *msg = &msg_generic->log;
@@ -578,7 +886,11 @@ static void process(const struct log_backend *const backend, union log_msg_gener
 		 * needed, because a log message can be generated with the level NONE, and such
 		 * a message should also be discarded if the configured maximum level is NONE.
 		 */
+#ifdef CONFIG_LOG_BACKEND_RPC_DICTIONARY
+		stream_message_dict(msg);
+#else
 		stream_message(msg);
+#endif
 	}
 
 #ifdef CONFIG_LOG_BACKEND_RPC_HISTORY
@@ -621,6 +933,11 @@ static void init(struct log_backend const *const backend)
 			   K_THREAD_STACK_SIZEOF(history_transfer_workq_stack),
 			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
 #endif
+#ifdef CONFIG_LOG_BACKEND_RPC_DICTIONARY
+	k_work_queue_init(&dict_workq);
+	k_work_queue_start(&dict_workq, dict_workq_stack, K_THREAD_STACK_SIZEOF(dict_workq_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+#endif
 }
 
 static void dropped(const struct log_backend *const backend, uint32_t cnt)
@@ -657,6 +974,16 @@ static const struct log_backend_api log_backend_rpc_api = {
 
 LOG_BACKEND_DEFINE(log_backend_rpc, log_backend_rpc_api, true);
 
+#ifdef CONFIG_LOG_BACKEND_RPC_DICTIONARY
+void log_backend_rpc_dict_bound(const struct nrf_rpc_group *group)
+{
+	ARG_UNUSED(group);
+
+	/* The remote has (re)started with an empty dictionary. */
+	atomic_set(&dict_invalidated, 1);
+}
+#endif
+
 static void log_rpc_set_stream_level_handler(const struct nrf_rpc_group *group,
 					     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
 {
@@ -672,6 +999,14 @@ static void log_rpc_set_stream_level_handler(const struct nrf_rpc_group *group,
 
 	stream_level = level;
 
+#ifdef CONFIG_LOG_BACKEND_RPC_DICTIONARY
+	/*
+	 * The remote may have been restarted and lost the dictionary, so have the strings
+	 * defined again. The slots are cleared by the logging thread to avoid blocking here.
+	 */
+	atomic_set(&dict_invalidated, 1);
+#endif
+
 	nrf_rpc_rsp_send_void(group);
 }
 
@@ -918,6 +1253,36 @@ static void log_rpc_echo_handler(const struct nrf_rpc_group *group, struct nrf_r
 NRF_RPC_CBOR_CMD_DECODER(log_rpc_group, log_rpc_echo_handler, LOG_RPC_CMD_ECHO,
 			 log_rpc_echo_handler, NULL);
 
+static void log_rpc_echo_count_handler(const struct nrf_rpc_group *group,
+				       struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	enum log_rpc_level level;
+	const char *log_msg;
+	size_t log_len;
+	uint32_t count;
+
+	level = nrf_rpc_decode_uint(ctx);
+	log_msg = nrf_rpc_decode_str_ptr_and_len(ctx, &log_len);
+	count = nrf_rpc_decode_uint(ctx);
+
+	if (log_msg) {
+		for (uint32_t i = 0; i < count; i++) {
+			put_log(level, "%.*s", log_len, log_msg);
+		}
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, group, LOG_RPC_CMD_ECHO_COUNT,
+			    NRF_RPC_PACKET_TYPE_CMD);
+		return;
+	}
+
+	nrf_rpc_rsp_send_void(group);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(log_rpc_group, log_rpc_echo_count_handler, LOG_RPC_CMD_ECHO_COUNT,
+			 log_rpc_echo_count_handler, NULL);
+
 #endif
 
 static log_timestamp_t log_rpc_timestamp(void)
@@ -19,18 +19,67 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/cbprintf.h>
 #include <zephyr/sys/util.h>
 
+#include <ctype.h>
+#include <string.h>
+
 LOG_MODULE_REGISTER(remote, LOG_LEVEL_DBG);
 
 static K_MUTEX_DEFINE(history_transfer_mtx);
 static uint32_t history_transfer_id;
 static log_rpc_history_handler_t history_handler;
 static log_rpc_history_threshold_reached_handler_t history_threshold_reached_handler;
+static struct log_rpc_stream_stats stream_stats;
+static struct k_spinlock stream_stats_lock;
+
+#ifdef CONFIG_LOG_FORWARDER_RPC_DICTIONARY
+#define DICT_HEXDUMP_BYTES_IN_LINE 16
+
+static char dict_fmts[CONFIG_LOG_RPC_DICTIONARY_FMT_SLOTS]
+		     [CONFIG_LOG_RPC_DICTIONARY_FMT_MAX_LEN + 1];
+static char dict_srcs[CONFIG_LOG_RPC_DICTIONARY_SRC_SLOTS]
+		     [CONFIG_LOG_RPC_DICTIONARY_SRC_MAX_LEN + 1];
+static uint8_t dict_pkg[CONFIG_LOG_FORWARDER_RPC_DICTIONARY_PACKAGE_SIZE]
+	__aligned(CBPRINTF_PACKAGE_ALIGNMENT);
+static char dict_text[CONFIG_LOG_FORWARDER_RPC_DICTIONARY_TEXT_SIZE];
+#endif
+
+static void stream_stats_update(size_t messages, size_t bytes)
+{
+	K_SPINLOCK(&stream_stats_lock) {
+		stream_stats.messages += messages;
+		stream_stats.events++;
+		stream_stats.bytes += bytes;
+	}
+}
+
+static void forward_message(enum log_rpc_level level, const char *message, size_t message_size)
+{
+	switch (level) {
+	case LOG_RPC_LEVEL_ERR:
+		LOG_ERR("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_WRN:
+		LOG_WRN("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_INF:
+		LOG_INF("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_DBG:
+		LOG_DBG("%.*s", message_size, message);
+		break;
+	default:
+		break;
+	}
+}
 
 static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 				void *handler_data)
 {
+	size_t event_size = ctx->zs[0].payload_end - ctx->zs[0].payload;
 	enum log_rpc_level level;
 	const char *message;
 	size_t message_size;
@@ -39,33 +88,332 @@ static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rp
 	message = nrf_rpc_decode_buffer_ptr_and_size(ctx, &message_size);
 
 	if (message) {
-		switch (level) {
-		case LOG_RPC_LEVEL_ERR:
-			LOG_ERR("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_WRN:
-			LOG_WRN("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_INF:
-			LOG_INF("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_DBG:
-			LOG_DBG("%.*s", message_size, message);
-			break;
-		default:
-			break;
-		}
+		forward_message(level, message, message_size);
 	}
 
 	if (!nrf_rpc_decoding_done_and_check(&log_rpc_group, ctx)) {
 		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, &log_rpc_group, LOG_RPC_EVT_MSG,
 			    NRF_RPC_PACKET_TYPE_EVT);
+		return;
 	}
+
+	stream_stats_update(1, event_size);
 }
 
 NRF_RPC_CBOR_EVT_DECODER(log_rpc_group, log_rpc_msg_handler, LOG_RPC_EVT_MSG, log_rpc_msg_handler,
 			 NULL);
 
+#ifdef CONFIG_LOG_FORWARDER_RPC_DICTIONARY
+
+/*
+ * Checks that all strings appended to the package are within the package, and that the format
+ * string is one of them, so that formatting never dereferences an address of the remote device.
+ */
+static bool dict_package_valid(const uint8_t *pkg, size_t len)
+{
+	union cbprintf_package_hdr hdr;
+	const uint8_t *str_end;
+	bool has_fmt = false;
+	size_t pos;
+
+	if (len < sizeof(hdr)) {
+		return false;
+	}
+
+	memcpy(&hdr, pkg, sizeof(hdr));
+	pos = hdr.desc.len * sizeof(int);
+
+	if (hdr.desc.ro_str_cnt != 0 || hdr.desc.rw_str_cnt != 0 ||
+	    hdr.desc.len <= LOG_RPC_DICT_FMT_IDX || pos > len) {
+		return false;
+	}
+
+	for (uint8_t i = 0; i < hdr.desc.str_cnt; i++) {
+		if (pos >= len || pkg[pos] >= hdr.desc.len) {
+			return false;
+		}
+
+		has_fmt |= pkg[pos] == LOG_RPC_DICT_FMT_IDX;
+		str_end = memchr(&pkg[pos + 1], '\0', len - pos - 1);
+
+		if (str_end == NULL) {
+			return false;
+		}
+
+		pos = str_end - pkg + 1;
+	}
+
+	return has_fmt && pos == len;
+}
+
+static int dict_text_out(int c, void *ctx)
+{
+	size_t *len = ctx;
+
+	if (*len < sizeof(dict_text)) {
+		dict_text[(*len)++] = (char)c;
+	}
+
+	return c;
+}
+
+static size_t dict_hexdump_line(size_t len, size_t indent, const uint8_t *data, size_t data_len)
+{
+	dict_text_out('\n', &len);
+
+	for (size_t i = 0; i < indent; i++) {
+		dict_text_out(' ', &len);
+	}
+
+	for (size_t i = 0; i < DICT_HEXDUMP_BYTES_IN_LINE; i++) {
+		if (i > 0 && (i % 8) == 0) {
+			dict_text_out(' ', &len);
+		}
+
+		if (i < data_len) {
+			len += snprintk(&dict_text[len], sizeof(dict_text) - len, "%02x ", data[i]);
+			len = MIN(len, sizeof(dict_text));
+		} else {
+			dict_text_out(' ', &len);
+			dict_text_out(' ', &len);
+			dict_text_out(' ', &len);
+		}
+	}
+
+	dict_text_out('|', &len);
+
+	for (size_t i = 0; i < data_len; i++) {
+		if (i > 0 && (i % 8) == 0) {
+			dict_text_out(' ', &len);
+		}
+
+		dict_text_out(isprint(data[i]) ? data[i] : '.', &len);
+	}
+
+	return len;
+}
+
+/* Formats the message the same way as the logging backend does in the text mode. */
+static size_t dict_format(uint64_t timestamp_us, const char *source, const uint8_t *data,
+			  size_t data_len)
+{
+	uint32_t ms = timestamp_us / USEC_PER_MSEC;
+	size_t indent;
+	size_t len;
+
+	len = snprintk(dict_text, sizeof(dict_text), "[%02u:%02u:%02u.%03u,%03u] ",
+		       ms / MSEC_PER_SEC / 3600, ms / MSEC_PER_SEC / 60 % 60,
+		       ms / MSEC_PER_SEC % 60, ms % MSEC_PER_SEC,
+		       (uint32_t)(timestamp_us % USEC_PER_MSEC));
+	len = MIN(len, sizeof(dict_text));
+
+	if (source != NULL) {
+		len += snprintk(&dict_text[len], sizeof(dict_text) - len, "%s: ", source);
+		len = MIN(len, sizeof(dict_text));
+	}
+
+	indent = len;
+	cbpprintf((cbprintf_cb)dict_text_out, &len, dict_pkg);
+
+	for (size_t i = 0; i < data_len; i += DICT_HEXDUMP_BYTES_IN_LINE) {
+		len = dict_hexdump_line(len, indent, &data[i],
+					MIN(data_len - i, DICT_HEXDUMP_BYTES_IN_LINE));
+	}
+
+	return len;
+}
+
+static const uint8_t *dict_message_process(const uint8_t *in, const uint8_t *end,
+					   uint64_t *timestamp_us)
+{
+	enum log_rpc_level level;
+	uint8_t src_slot;
+	uint8_t fmt_slot;
+	const char *source = NULL;
+	const char *fmt = NULL;
+	int64_t timestamp_delta;
+	const uint8_t *pkg;
+	size_t pkg_len;
+	const uint8_t *data;
+	size_t data_len;
+	size_t len;
+	union cbprintf_package_hdr hdr;
+
+	if (end - in < 4) {
+		return NULL;
+	}
+
+	level = in[1];
+	src_slot = in[2];
+	fmt_slot = in[3];
+	in += 4;
+
+	len = log_rpc_dict_varint_decode(in, end - in, &timestamp_delta);
+
+	if (len == 0 || end - in < len + sizeof(uint16_t)) {
+		return NULL;
+	}
+
+	*timestamp_us += timestamp_delta;
+	in += len;
+	pkg_len = sys_get_le16(in);
+	in += sizeof(uint16_t);
+
+	if (end - in < pkg_len + sizeof(uint16_t)) {
+		return NULL;
+	}
+
+	pkg = in;
+	in += pkg_len;
+	data_len = sys_get_le16(in);
+	in += sizeof(uint16_t);
+
+	if (end - in < data_len) {
+		return NULL;
+	}
+
+	data = in;
+	in += data_len;
+
+	if (src_slot < ARRAY_SIZE(dict_srcs) && dict_srcs[src_slot][0] != '\0') {
+		source = dict_srcs[src_slot];
+	}
+
+	if (fmt_slot != LOG_RPC_DICT_SLOT_NONE) {
+		if (fmt_slot >= ARRAY_SIZE(dict_fmts) || dict_fmts[fmt_slot][0] == '\0') {
+			LOG_WRN("Unknown format string slot: %u", fmt_slot);
+			return in;
+		}
+
+		fmt = dict_fmts[fmt_slot];
+	}
+
+	/* Copy the package to an aligned buffer and append the format string if needed. */
+	len = pkg_len + (fmt != NULL ? strlen(fmt) + 2 : 0);
+
+	if (len > sizeof(dict_pkg) || pkg_len < sizeof(hdr)) {
+		LOG_WRN("Invalid log message package length: %zu", pkg_len);
+		return in;
+	}
+
+	memcpy(dict_pkg, pkg, pkg_len);
+
+	if (fmt != NULL) {
+		dict_pkg[pkg_len] = LOG_RPC_DICT_FMT_IDX;
+		strcpy((char *)&dict_pkg[pkg_len + 1], fmt);
+		memcpy(&hdr, dict_pkg, sizeof(hdr));
+		hdr.desc.str_cnt++;
+		memcpy(dict_pkg, &hdr, sizeof(hdr));
+	}
+
+	if (!dict_package_valid(dict_pkg, len)) {
+		LOG_WRN("Malformed log message package");
+		return in;
+	}
+
+	forward_message(level, dict_text, dict_format(*timestamp_us, source, data, data_len));
+
+	return in;
+}
+
+static const uint8_t *dict_definition_process(const uint8_t *in, const uint8_t *end)
+{
+	uint8_t type;
+	uint8_t slot;
+	size_t len;
+	char *str;
+	size_t max_len;
+
+	if (end - in < LOG_RPC_DICT_DEF_HDR_LEN) {
+		return NULL;
+	}
+
+	type = in[0];
+	slot = in[1];
+	len = in[2];
+	in += LOG_RPC_DICT_DEF_HDR_LEN;
+
+	if (end - in < len) {
+		return NULL;
+	}
+
+	if (type == LOG_RPC_DICT_ENTRY_DEF_FMT && slot < ARRAY_SIZE(dict_fmts)) {
+		str = dict_fmts[slot];
+		max_len = sizeof(dict_fmts[slot]) - 1;
+	} else if (type == LOG_RPC_DICT_ENTRY_DEF_SRC && slot < ARRAY_SIZE(dict_srcs)) {
+		str = dict_srcs[slot];
+		max_len = sizeof(dict_srcs[slot]) - 1;
+	} else {
+		LOG_WRN("Dictionary slot out of range: %u", slot);
+		return in + len;
+	}
+
+	if (type == LOG_RPC_DICT_ENTRY_DEF_FMT && len > max_len) {
+		/* A truncated format string could not be used safely */
+		str[0] = '\0';
+		return in + len;
+	}
+
+	memcpy(str, in, MIN(len, max_len));
+	str[MIN(len, max_len)] = '\0';
+
+	return in + len;
+}
+
+static void log_rpc_msg_batch_handler(const struct nrf_rpc_group *group,
+				      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	size_t event_size = ctx->zs[0].payload_end - ctx->zs[0].payload;
+	uint64_t timestamp_us = 0;
+	size_t messages = 0;
+	const uint8_t *batch;
+	const uint8_t *end;
+	size_t batch_size;
+
+	batch = nrf_rpc_decode_buffer_ptr_and_size(ctx, &batch_size);
+	end = batch + batch_size;
+
+	while (batch != NULL && batch < end) {
+		if (batch[0] == LOG_RPC_DICT_ENTRY_MSG) {
+			batch = dict_message_process(batch, end, &timestamp_us);
+			messages++;
+		} else {
+			batch = dict_definition_process(batch, end);
+		}
+	}
+
+	if (batch == NULL) {
+		LOG_WRN("Truncated log message batch");
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(&log_rpc_group, ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, &log_rpc_group, LOG_RPC_EVT_MSG_BATCH,
+			    NRF_RPC_PACKET_TYPE_EVT);
+		return;
+	}
+
+	stream_stats_update(messages, event_size);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(log_rpc_group, log_rpc_msg_batch_handler, LOG_RPC_EVT_MSG_BATCH,
+			 log_rpc_msg_batch_handler, NULL);
+
+#endif /* CONFIG_LOG_FORWARDER_RPC_DICTIONARY */
+
+void log_rpc_get_stream_stats(struct log_rpc_stream_stats *stats)
+{
+	K_SPINLOCK(&stream_stats_lock) {
+		*stats = stream_stats;
+	}
+}
+
+void log_rpc_reset_stream_stats(void)
+{
+	K_SPINLOCK(&stream_stats_lock) {
+		memset(&stream_stats, 0, sizeof(stream_stats));
+	}
+}
+
 void log_rpc_set_stream_level(enum log_rpc_level level)
 {
 	struct nrf_rpc_cbor_ctx ctx;
@@ -228,6 +576,20 @@ void log_rpc_echo(enum log_rpc_level level, const char *message)
 	nrf_rpc_cbor_decoding_done(&log_rpc_group, &ctx);
 }
 
+void log_rpc_echo_count(enum log_rpc_level level, const char *message, uint32_t count)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t message_size = strlen(message);
+
+	NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, 9 + message_size);
+	nrf_rpc_encode_uint(&ctx, level);
+	nrf_rpc_encode_str(&ctx, message, message_size);
+	nrf_rpc_encode_uint(&ctx, count);
+	nrf_rpc_cbor_cmd_rsp_no_err(&log_rpc_group, LOG_RPC_CMD_ECHO_COUNT, &ctx);
+
+	nrf_rpc_cbor_decoding_done(&log_rpc_group, &ctx);
+}
+
 static void log_rpc_history_threshold_reached_handler(const struct nrf_rpc_group *group,
 						      struct nrf_rpc_cbor_ctx *ctx,
 						      void *handler_data)
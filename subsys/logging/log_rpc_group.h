@@ -9,6 +9,7 @@
 
 #include <nrf_rpc.h>
 #include <zephyr/device.h>
+#include <zephyr/sys/cbprintf.h>
 
 #ifdef CONFIG_NRF_RPC_IPC_SERVICE
 #include <nrf_rpc/nrf_rpc_ipc.h>
@@ -25,13 +26,84 @@ NRF_RPC_IPC_TRANSPORT(log_rpc_tr, DEVICE_DT_GET(DT_NODELABEL(ipc0)), "log_rpc_ep
 #elif defined(CONFIG_NRF_RPC_UART_TRANSPORT)
 #define log_rpc_tr NRF_RPC_UART_TRANSPORT(DT_CHOSEN(nordic_rpc_uart))
 #endif
-NRF_RPC_GROUP_DEFINE(log_rpc_group, "log", &log_rpc_tr, NULL, NULL, NULL);
+
+#ifdef CONFIG_LOG_BACKEND_RPC_DICTIONARY
+/* Makes the backend define the dictionary strings again after the remote has (re)started. */
+void log_backend_rpc_dict_bound(const struct nrf_rpc_group *group);
+#define LOG_RPC_BOUND_HANDLER log_backend_rpc_dict_bound
+#else
+#define LOG_RPC_BOUND_HANDLER NULL
+#endif
+
+NRF_RPC_GROUP_DEFINE_NOWAIT(log_rpc_group, "log", &log_rpc_tr, NULL, NULL, NULL,
+			    LOG_RPC_BOUND_HANDLER, true);
 
 enum log_rpc_evt_forwarder {
 	LOG_RPC_EVT_MSG = 0,
 	LOG_RPC_EVT_HISTORY_THRESHOLD_REACHED = 1,
+	LOG_RPC_EVT_MSG_BATCH = 2,
 };
 
+/*
+ * Entries of the LOG_RPC_EVT_MSG_BATCH event payload:
+ *
+ * DEF_FMT, DEF_SRC: [type][slot][length][string without the null terminator]
+ * MSG: [type][level][source slot][format slot][timestamp delta][package length][package]
+ *      [data length][data]
+ *
+ * A definition assigns the string to the dictionary slot until the slot is redefined.
+ * The timestamp delta is a zigzag LEB128 varint, in microseconds, relative to the previous
+ * message in the same batch. The package length is a 16-bit little-endian value.
+ * The package is a self-contained cbprintf package. If the format slot is not
+ * LOG_RPC_DICT_SLOT_NONE, the format string is not included in the package and must be
+ * appended from the dictionary before the package is formatted. The data length is a 16-bit
+ * little-endian value, and the data is the hexdump data of the message, if any.
+ */
+enum log_rpc_dict_entry {
+	LOG_RPC_DICT_ENTRY_MSG = 0,
+	LOG_RPC_DICT_ENTRY_DEF_FMT,
+	LOG_RPC_DICT_ENTRY_DEF_SRC,
+};
+
+#define LOG_RPC_DICT_SLOT_NONE 0xff
+#define LOG_RPC_DICT_VARINT_MAX_LEN 10
+#define LOG_RPC_DICT_MSG_HDR_MAX_LEN (4 + LOG_RPC_DICT_VARINT_MAX_LEN + 2 + 2)
+#define LOG_RPC_DICT_DEF_HDR_LEN 3
+
+/* Index of the format string argument in a cbprintf package, in 32-bit words. */
+#define LOG_RPC_DICT_FMT_IDX (sizeof(union cbprintf_package_hdr) / sizeof(int))
+
+static inline size_t log_rpc_dict_varint_encode(uint8_t *out, int64_t value)
+{
+	uint64_t zigzag = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+	size_t len = 0;
+
+	do {
+		out[len] = (zigzag & 0x7f) | (zigzag > 0x7f ? 0x80 : 0);
+		zigzag >>= 7;
+	} while (out[len++] & 0x80);
+
+	return len;
+}
+
+static inline size_t log_rpc_dict_varint_decode(const uint8_t *in, size_t in_len, int64_t *value)
+{
+	uint64_t zigzag = 0;
+	size_t len = 0;
+
+	do {
+		if (len == in_len || len == LOG_RPC_DICT_VARINT_MAX_LEN) {
+			return 0;
+		}
+
+		zigzag |= (uint64_t)(in[len] & 0x7f) << (7 * len);
+	} while (in[len++] & 0x80);
+
+	*value = (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+
+	return len;
+}
+
 enum log_rpc_cmd_forwarder {
 	LOG_RPC_CMD_PUT_HISTORY_CHUNK = 0,
 };
@@ -50,6 +122,7 @@ enum log_rpc_cmd_backend {
 	LOG_RPC_CMD_ECHO,
 	LOG_RPC_CMD_SET_TIME,
 	LOG_RPC_CMD_GET_CRASH_INFO,
+	LOG_RPC_CMD_ECHO_COUNT,
 };
 
 #ifdef __cplusplus
@@ -35,6 +35,36 @@ LOG_MODULE_DECLARE(downloader, CONFIG_DOWNLOADER_LOG_LEVEL);
 #define COAP "coap://"
 #define COAPS "coaps://"
 
+/* Space reserved for the CoAP header and options of a response in windowed mode. */
+#define WINDOW_RESPONSE_OVERHEAD 64
+/* Congestion window unit, the window is kept in 1/16 of a block. */
+#define CWND_UNIT 16
+
+enum window_slot_state {
+	SLOT_FREE,
+	SLOT_REQUESTED,
+	SLOT_RECEIVED,
+};
+
+struct window_slot {
+	/** Offset of the requested block in the file. */
+	size_t offset;
+	/** Time when the request was last sent. */
+	uint32_t t0;
+	/** Current retransmission timeout. */
+	uint32_t timeout;
+	/** Message ID of the request. */
+	uint16_t id;
+	/** Length of the stored payload. */
+	uint16_t len;
+	/** Number of retransmissions. */
+	uint8_t retries;
+	/** Storage area of the payload received out of order. */
+	uint8_t area;
+	/** Slot state. */
+	uint8_t state;
+};
+
 struct transport_params_coap {
 	/** Flag whether config is set */
 	bool cfg_set;
@@ -60,6 +90,26 @@ struct transport_params_coap {
 		struct net_sockaddr remote_addr;
 	} sock;
 
+	/** Windowed block-wise transfer */
+	struct {
+		/** Block requests. */
+		struct window_slot slot[CONFIG_DOWNLOADER_TRANSPORT_COAP_WINDOW_MAX];
+		/** Offset of the next block to request. */
+		size_t next_offset;
+		/** Congestion window, in CWND_UNIT per block. */
+		uint16_t cwnd;
+		/** Slow start threshold, in blocks. */
+		uint8_t ssthresh;
+		/** Window limit given by the configuration and buffer size, zero if disabled. */
+		uint8_t limit;
+		/** Bitmask of used payload storage areas. */
+		uint8_t areas_used;
+		/** Negotiated block size. */
+		uint8_t block_size;
+		/** A response was received on the current connection. */
+		bool path_ok;
+	} window;
+
 	/** Request new data */
 	bool new_data_req;
 	/** Request retransmission */
@@ -273,25 +323,18 @@ static int coap_parse(struct downloader *dl, size_t len)
 	return 0;
 }
 
-static int coap_request_send(struct downloader *dl)
+static int coap_request_build(struct downloader *dl, struct coap_packet *request, size_t max_len,
+			      uint16_t id, struct coap_block_context *block_ctx)
 {
 	int err;
-	uint16_t id;
 	char file[FILENAME_SIZE];
 	char *path_elem;
 	char *path_elem_saveptr;
-	struct coap_packet request;
 	struct transport_params_coap *coap;
 
 	coap = (struct transport_params_coap *)dl->transport_internal;
 
-	if (has_pending(dl)) {
-		id = coap->pending.id;
-	} else {
-		id = coap_next_id();
-	}
-
-	err = coap_packet_init(&request, dl->cfg.buf, dl->cfg.buf_size, COAP_VER,
+	err = coap_packet_init(request, dl->cfg.buf, max_len, COAP_VER,
 			       COAP_TYPE_CON, 8, coap_next_token(), COAP_METHOD_GET, id);
 	if (err) {
 		LOG_ERR("Failed to init CoAP message, err %d", err);
@@ -303,7 +346,7 @@ static int coap_request_send(struct downloader *dl)
 
 	path_elem = strtok_r(file, COAP_PATH_ELEM_DELIM, &path_elem_saveptr);
 	do {
-		err = coap_packet_append_option(&request, COAP_OPTION_URI_PATH, path_elem,
+		err = coap_packet_append_option(request, COAP_OPTION_URI_PATH, path_elem,
 						strlen(path_elem));
 		if (err) {
 			LOG_ERR("Unable add option to request");
@@ -311,20 +354,20 @@ static int coap_request_send(struct downloader *dl)
 		}
 	} while ((path_elem = strtok_r(NULL, COAP_PATH_ELEM_DELIM, &path_elem_saveptr)));
 
-	err = coap_append_block2_option(&request, &coap->block_ctx);
+	err = coap_append_block2_option(request, block_ctx);
 	if (err) {
 		LOG_ERR("Unable to add block2 option");
 		return err;
 	}
 
-	err = coap_append_size2_option(&request, &coap->block_ctx);
+	err = coap_append_size2_option(request, block_ctx);
 	if (err) {
 		LOG_ERR("Unable to add size2 option");
 		return err;
 	}
 
 	if (coap->proxy_uri != NULL) {
-		err = coap_packet_append_option(&request, COAP_OPTION_PROXY_URI,
+		err = coap_packet_append_option(request, COAP_OPTION_PROXY_URI,
 			coap->proxy_uri, strlen(coap->proxy_uri));
 		if (err) {
 			LOG_ERR("Unable to add Proxy-URI option");
@@ -332,6 +375,29 @@ static int coap_request_send(struct downloader *dl)
 		}
 	}
 
+	return 0;
+}
+
+static int coap_request_send(struct downloader *dl)
+{
+	int err;
+	uint16_t id;
+	struct coap_packet request;
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	if (has_pending(dl)) {
+		id = coap->pending.id;
+	} else {
+		id = coap_next_id();
+	}
+
+	err = coap_request_build(dl, &request, dl->cfg.buf_size, id, &coap->block_ctx);
+	if (err) {
+		return err;
+	}
+
 	if (!has_pending(dl)) {
 		struct coap_transmission_parameters params = coap_get_transmission_parameters();
 
@@ -364,6 +430,461 @@ static int coap_request_send(struct downloader *dl)
 	return 0;
 }
 
+static size_t window_scratch_size(struct downloader *dl)
+{
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	return MIN(coap_block_size_to_bytes(coap->cfg.block_size) + WINDOW_RESPONSE_OVERHEAD,
+		   dl->cfg.buf_size);
+}
+
+/* The beginning of the buffer is used to build requests and receive responses.
+ * The rest is split into areas that keep blocks received out of order.
+ */
+static uint8_t *window_area(struct downloader *dl, uint8_t area)
+{
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	return dl->cfg.buf + window_scratch_size(dl) +
+	       area * coap_block_size_to_bytes(coap->cfg.block_size);
+}
+
+static void coap_window_init(struct downloader *dl)
+{
+	size_t area_cnt;
+	size_t block_bytes;
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	memset(&coap->window, 0, sizeof(coap->window));
+
+	if (coap->cfg.window_size <= 1) {
+		return;
+	}
+
+	block_bytes = coap_block_size_to_bytes(coap->cfg.block_size);
+	area_cnt = (dl->cfg.buf_size - window_scratch_size(dl)) / block_bytes;
+
+	coap->window.limit = MIN(coap->cfg.window_size, CONFIG_DOWNLOADER_TRANSPORT_COAP_WINDOW_MAX);
+	coap->window.limit = MIN(coap->window.limit, area_cnt + 1);
+	if (coap->window.limit <= 1) {
+		LOG_WRN("Buffer too small for windowed transfer, requesting one block at a time");
+		coap->window.limit = 0;
+		return;
+	}
+
+	coap->window.block_size = coap->cfg.block_size;
+	coap->window.next_offset = ROUND_DOWN(dl->progress, block_bytes);
+	coap->window.cwnd = CWND_UNIT;
+	coap->window.ssthresh = coap->window.limit;
+
+	LOG_DBG("Windowed transfer, up to %d blocks in flight", coap->window.limit);
+}
+
+static bool coap_window_active(struct downloader *dl)
+{
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	return coap->window.limit > 1;
+}
+
+static uint8_t window_occupied(struct transport_params_coap *coap)
+{
+	uint8_t cnt = 0;
+
+	for (size_t i = 0; i < coap->window.limit; i++) {
+		if (coap->window.slot[i].state != SLOT_FREE) {
+			cnt++;
+		}
+	}
+
+	return cnt;
+}
+
+static int window_request_send(struct downloader *dl, struct window_slot *slot)
+{
+	int err;
+	struct coap_packet request;
+	struct coap_block_context block_ctx = {0};
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	block_ctx.block_size = coap->window.block_size;
+	block_ctx.current = slot->offset;
+
+	/* Blocks received out of order are kept after the scratch area. */
+	err = coap_request_build(dl, &request, window_scratch_size(dl), slot->id, &block_ctx);
+	if (err) {
+		return err;
+	}
+
+	LOG_DBG("CoAP block at %zu, id %d, retry %d", slot->offset, slot->id, slot->retries);
+
+	err = dl_socket_send(coap->sock.fd, dl->cfg.buf, request.offset);
+	if (err) {
+		LOG_ERR("Failed to send CoAP request, errno %d", errno);
+		return err;
+	}
+
+	slot->t0 = k_uptime_get_32();
+
+	return 0;
+}
+
+/* Request new blocks while the congestion window allows. */
+static int window_fill(struct downloader *dl)
+{
+	int err;
+	uint8_t occupied;
+	struct window_slot *slot;
+	struct coap_transmission_parameters params;
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	while (true) {
+		occupied = window_occupied(coap);
+
+		if (occupied >= MIN(MAX(coap->window.cwnd / CWND_UNIT, 1), coap->window.limit)) {
+			break;
+		}
+
+		if (dl->file_size == 0 && occupied > 0) {
+			/* Total size is not known yet, request one block at a time. */
+			break;
+		}
+
+		if (dl->file_size && coap->window.next_offset >= dl->file_size) {
+			break;
+		}
+
+		slot = NULL;
+		for (size_t i = 0; i < coap->window.limit; i++) {
+			if (coap->window.slot[i].state == SLOT_FREE) {
+				slot = &coap->window.slot[i];
+				break;
+			}
+		}
+
+		__ASSERT_NO_MSG(slot);
+
+		params = coap_get_transmission_parameters();
+
+		slot->offset = coap->window.next_offset;
+		slot->id = coap_next_id();
+		slot->retries = 0;
+		slot->timeout = params.ack_timeout;
+		slot->state = SLOT_REQUESTED;
+
+		err = window_request_send(dl, slot);
+		if (err) {
+			return err;
+		}
+
+		coap->window.next_offset += coap_block_size_to_bytes(coap->window.block_size);
+	}
+
+	return 0;
+}
+
+/* Retransmit requests that timed out. */
+static int window_retransmit(struct downloader *dl)
+{
+	int err;
+	uint32_t now = k_uptime_get_32();
+	struct window_slot *slot;
+	struct coap_transmission_parameters params;
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	for (size_t i = 0; i < coap->window.limit; i++) {
+		slot = &coap->window.slot[i];
+
+		if ((slot->state != SLOT_REQUESTED) || ((now - slot->t0) < slot->timeout)) {
+			continue;
+		}
+
+		if (slot->retries >= coap->cfg.max_retransmission) {
+			LOG_ERR("CoAP max-retransmissions exceeded");
+			return -ECONNRESET;
+		}
+
+		params = coap_get_transmission_parameters();
+
+		slot->retries++;
+		slot->timeout = slot->timeout * params.coap_backoff_percent / 100;
+
+		/* Treat the timeout as congestion, restart from a single block. */
+		coap->window.ssthresh = MAX(window_occupied(coap) / 2, 1);
+		coap->window.cwnd = CWND_UNIT;
+
+		if (!coap->window.path_ok && (slot->retries >= 2) &&
+		    (window_occupied(coap) == 1) && (coap->window.block_size > COAP_BLOCK_16)) {
+			/* Nothing got through yet, the path may not carry blocks this large. */
+			coap->window.block_size--;
+			slot->offset = ROUND_DOWN(dl->progress,
+						  coap_block_size_to_bytes(coap->window.block_size));
+			slot->id = coap_next_id();
+			coap->window.next_offset =
+				slot->offset + coap_block_size_to_bytes(coap->window.block_size);
+			LOG_WRN("No response, reducing block size to %d",
+				coap_block_size_to_bytes(coap->window.block_size));
+		}
+
+		err = window_request_send(dl, slot);
+		if (err) {
+			LOG_DBG("Retransmission failed, err %d", err);
+			return -ECONNRESET;
+		}
+	}
+
+	return 0;
+}
+
+/* Time left until the first request times out. */
+static int32_t window_recv_timeout(struct transport_params_coap *coap)
+{
+	int32_t timeout = INT32_MAX;
+	int32_t left;
+	uint32_t now = k_uptime_get_32();
+
+	for (size_t i = 0; i < coap->window.limit; i++) {
+		struct window_slot *slot = &coap->window.slot[i];
+
+		if (slot->state == SLOT_REQUESTED) {
+			left = (int32_t)(slot->t0 + slot->timeout - now);
+			timeout = MIN(timeout, left);
+		}
+	}
+
+	return timeout;
+}
+
+static void window_deliver(struct downloader *dl, const uint8_t *payload, size_t offset,
+			   size_t len)
+{
+	size_t skip;
+
+	/* Part of the block may have been received before reconnecting. */
+	skip = dl->progress - offset;
+	if (skip >= len) {
+		return;
+	}
+
+	dl->progress += len - skip;
+	dl_transport_evt_data(dl, (void *)(payload + skip), len - skip);
+}
+
+static void window_ack(struct transport_params_coap *coap, struct window_slot *slot)
+{
+	if (slot->retries) {
+		/* Round trip is ambiguous, do not grow the window. */
+		return;
+	}
+
+	if (coap->window.cwnd < coap->window.ssthresh * CWND_UNIT) {
+		/* Slow start, one block more per response. */
+		coap->window.cwnd += CWND_UNIT;
+	} else {
+		/* Congestion avoidance, one block more per window. */
+		coap->window.cwnd += MAX(CWND_UNIT * CWND_UNIT / coap->window.cwnd, 1);
+	}
+
+	coap->window.cwnd = MIN(coap->window.cwnd, coap->window.limit * CWND_UNIT);
+}
+
+static void window_parse(struct downloader *dl, size_t len)
+{
+	bool delivered;
+	int err;
+	int block;
+	int size2;
+	size_t offset;
+	size_t block_bytes;
+	uint16_t id;
+	uint16_t payload_len;
+	uint8_t response_code;
+	const uint8_t *payload;
+	struct coap_packet response;
+	struct window_slot *slot = NULL;
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	err = coap_packet_parse(&response, dl->cfg.buf, len, NULL, 0);
+	if (err) {
+		LOG_ERR("Failed to parse CoAP packet, err %d", err);
+		return;
+	}
+
+	id = coap_header_get_id(&response);
+	for (size_t i = 0; i < coap->window.limit; i++) {
+		if ((coap->window.slot[i].state == SLOT_REQUESTED) &&
+		    (coap->window.slot[i].id == id)) {
+			slot = &coap->window.slot[i];
+			break;
+		}
+	}
+
+	/* Invalid responses are dropped, the request is retransmitted when it times out. */
+	if (!slot) {
+		LOG_DBG("Response %d is not pending", id);
+		return;
+	}
+
+	if (coap_header_get_type(&response) != COAP_TYPE_ACK) {
+		LOG_ERR("Response must be of coap type ACK");
+		return;
+	}
+
+	response_code = coap_header_get_code(&response);
+	if (response_code != COAP_RESPONSE_CODE_CONTENT) {
+		LOG_ERR("Server responded with code 0x%x", response_code);
+		return;
+	}
+
+	block = coap_get_option_int(&response, COAP_OPTION_BLOCK2);
+	if (block < 0) {
+		LOG_ERR("Failed to get block2 option, err %d", block);
+		return;
+	}
+
+	if (!coap->window.path_ok && (GET_BLOCK_SIZE(block) < coap->window.block_size)) {
+		/* Server uses smaller blocks, request the rest of the file in them.
+		 * Only the first block is in flight at this point.
+		 */
+		coap->window.block_size = GET_BLOCK_SIZE(block);
+		coap->window.next_offset = slot->offset +
+					   coap_block_size_to_bytes(coap->window.block_size);
+	}
+
+	block_bytes = coap_block_size_to_bytes(coap->window.block_size);
+	offset = GET_BLOCK_NUM(block) * block_bytes;
+
+	if ((GET_BLOCK_SIZE(block) != coap->window.block_size) || (offset != slot->offset)) {
+		LOG_WRN("Unexpected block at %zu, expected %zu", offset, slot->offset);
+		return;
+	}
+
+	payload = coap_packet_get_payload(&response, &payload_len);
+	if (!payload || (payload_len > block_bytes) ||
+	    (GET_MORE(block) && (payload_len != block_bytes))) {
+		LOG_WRN("Invalid CoAP payload");
+		return;
+	}
+
+	coap->window.path_ok = true;
+	window_ack(coap, slot);
+
+	size2 = coap_get_option_int(&response, COAP_OPTION_SIZE2);
+	if (dl->file_size == 0 && size2 > 0) {
+		LOG_DBG("Total size: %d", size2);
+		dl->file_size = size2;
+	}
+
+	if (!GET_MORE(block)) {
+		LOG_DBG("Last block received");
+		/* Mark the end, in case we did not know the total size */
+		dl->file_size = offset + payload_len;
+	}
+
+	if (offset > dl->progress) {
+		/* Keep the block until the preceding ones are received. */
+		slot->area = find_lsb_set(~coap->window.areas_used) - 1;
+		__ASSERT_NO_MSG(slot->area < coap->window.limit - 1);
+
+		memcpy(window_area(dl, slot->area), payload, payload_len);
+		coap->window.areas_used |= BIT(slot->area);
+		slot->len = payload_len;
+		slot->state = SLOT_RECEIVED;
+
+		LOG_DBG("Block at %zu received out of order", offset);
+		return;
+	}
+
+	window_deliver(dl, payload, offset, payload_len);
+	slot->state = SLOT_FREE;
+
+	/* Deliver the blocks that were waiting for this one. Blocks are stored in any order. */
+	do {
+		delivered = false;
+
+		for (size_t i = 0; i < coap->window.limit; i++) {
+			slot = &coap->window.slot[i];
+
+			if ((slot->state == SLOT_RECEIVED) && (slot->offset == dl->progress)) {
+				window_deliver(dl, window_area(dl, slot->area), slot->offset,
+					       slot->len);
+				coap->window.areas_used &= ~BIT(slot->area);
+				slot->state = SLOT_FREE;
+				delivered = true;
+			}
+		}
+	} while (delivered);
+}
+
+static int coap_window_download(struct downloader *dl)
+{
+	int ret, len;
+	int32_t timeout;
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	dl->buf_offset = 0;
+
+	ret = window_retransmit(dl);
+	if (ret) {
+		return ret;
+	}
+
+	ret = window_fill(dl);
+	if (ret) {
+		LOG_DBG("data_req failed, err %d", ret);
+		/** Attempt reconnection. */
+		return -ECONNRESET;
+	}
+
+	timeout = window_recv_timeout(coap);
+	if (timeout <= 0) {
+		/* Retransmit on next cycle. */
+		return 0;
+	}
+
+	ret = dl_socket_recv_timeout_set(coap->sock.fd, timeout);
+	if (ret) {
+		LOG_DBG("Failed to set CoAP recv timeout, err %d", ret);
+		return ret;
+	}
+
+	len = dl_socket_recv(coap->sock.fd, dl->cfg.buf, window_scratch_size(dl));
+	if (len < 0) {
+		if ((len == -ETIMEDOUT) || (len == -EWOULDBLOCK) || (len == -EAGAIN)) {
+			/* Retransmit on next cycle. */
+			return 0;
+		}
+
+		return len;
+	}
+
+	window_parse(dl, len);
+
+	if (dl->file_size && (dl->progress == dl->file_size)) {
+		dl->complete = true;
+	}
+
+	return 0;
+}
+
 static bool dl_coap_proto_supported(struct downloader *dl, const char *url)
 {
 	if (strncmp(url, COAPS, (sizeof(COAPS) - 1)) == 0) {
@@ -465,6 +986,7 @@ static int dl_coap_connect(struct downloader *dl)
 	}
 
 	coap_block_init(dl, dl->progress);
+	coap_window_init(dl);
 
 cleanup:
 	if (err) {
@@ -505,6 +1027,10 @@ static int dl_coap_download(struct downloader *dl)
 
 	coap = (struct transport_params_coap *)dl->transport_internal;
 
+	if (coap_window_active(dl)) {
+		return coap_window_download(dl);
+	}
+
 	if (coap->new_data_req) {
 		/* Request next fragment */
 		dl->buf_offset = 0;
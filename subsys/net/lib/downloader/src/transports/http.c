@@ -105,6 +105,16 @@ struct transport_params_http {
 		struct net_sockaddr remote_addr;
 	} sock;
 
+	/** Pipelined range requests */
+	struct {
+		/** Offset of the first byte that is not requested yet. */
+		size_t req_offset;
+		/** Number of requests sent but not fully received. */
+		uint8_t outstanding;
+		/** Data of the next response is left in the buffer. */
+		bool buffered;
+	} pipeline;
+
 	/** Request new data */
 	bool new_data_req;
 	/** Redirect retries */
@@ -144,9 +154,100 @@ extern char *strnstr(const char *haystack, const char *needle, size_t haystack_s
 
 static int parse_protocol(struct downloader *dl, const char *url);
 
-static int http_get_request_send(struct downloader *dl)
+static int http_request_send(struct downloader *dl, int len)
 {
 	int err;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	if (len < 0 || len > dl->cfg.buf_size) {
+		LOG_ERR("Cannot create GET request, buffer too small");
+		return -ENOMEM;
+	}
+
+	if (IS_ENABLED(CONFIG_DOWNLOADER_LOG_HEADERS)) {
+		LOG_HEXDUMP_DBG(dl->cfg.buf, len, "HTTP request");
+	}
+
+	LOG_DBG("http request:\n%s", dl->cfg.buf);
+
+	err = dl_socket_send(http->sock.fd, dl->cfg.buf, len);
+	if (err) {
+		LOG_ERR("Failed to send HTTP request, errno %d", errno);
+		return err;
+	}
+
+	return 0;
+}
+
+static uint8_t http_pipeline_depth(struct transport_params_http *http)
+{
+	return http->cfg.pipeline_depth ? http->cfg.pipeline_depth :
+					  CONFIG_DOWNLOADER_TRANSPORT_HTTP_PIPELINE_DEPTH;
+}
+
+static bool http_pipeline_active(struct downloader *dl)
+{
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	return http->ranged && (http_pipeline_depth(http) > 1);
+}
+
+/* Send range requests until the pipeline is full or the whole file is requested.
+ * The file size must be known, so the first response must be received before
+ * the pipeline can be filled.
+ */
+static int http_pipeline_fill(struct downloader *dl)
+{
+	int err;
+	int len;
+	size_t off;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	while ((http->pipeline.outstanding < http_pipeline_depth(http)) &&
+	       dl->file_size && (http->pipeline.req_offset < dl->file_size) &&
+	       !http->connection_close) {
+		off = MIN(http->pipeline.req_offset + dl->host_cfg.range_override,
+			  dl->file_size) - 1;
+
+		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_RANGE, dl->file,
+			       dl->hostname, http->pipeline.req_offset, off);
+
+		err = http_request_send(dl, len);
+		if (err) {
+			return err;
+		}
+
+		LOG_DBG("Pipelined range request %zu-%zu", http->pipeline.req_offset, off);
+
+		http->pipeline.req_offset = off + 1;
+		http->pipeline.outstanding++;
+	}
+
+	return 0;
+}
+
+static void http_pipeline_response_done(struct downloader *dl)
+{
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	__ASSERT_NO_MSG(http->pipeline.outstanding > 0);
+
+	http->pipeline.outstanding--;
+	http->ranged_progress = 0;
+	http->header.has_end = false;
+	http->header.status_code = 0;
+}
+
+static int http_get_request_send(struct downloader *dl)
+{
 	int len;
 	size_t off = 0;
 	bool tls_force_range;
@@ -155,6 +256,8 @@ static int http_get_request_send(struct downloader *dl)
 	http = (struct transport_params_http *)dl->transport_internal;
 
 	http->header.has_end = false;
+	http->pipeline.outstanding = 0;
+	http->pipeline.buffered = false;
 
 	/* nRF91 series has a limitation of decoding ~2k of data at once when using TLS */
 	tls_force_range = (http->sock.proto == NET_IPPROTO_TLS_1_2 &&
@@ -180,8 +283,9 @@ static int http_get_request_send(struct downloader *dl)
 			       dl->hostname, dl->progress, off);
 		http->ranged = true;
 		http->ranged_progress = 0;
+		http->pipeline.req_offset = off + 1;
+		http->pipeline.outstanding = 1;
 		LOG_DBG("Range request up to %d bytes", dl->host_cfg.range_override);
-		goto send;
 	} else if (dl->progress) {
 		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_OFFSET, dl->file,
 			       dl->hostname, dl->progress);
@@ -192,25 +296,7 @@ static int http_get_request_send(struct downloader *dl)
 		http->ranged = false;
 	}
 
-send:
-	if (len < 0 || len > dl->cfg.buf_size) {
-		LOG_ERR("Cannot create GET request, buffer too small");
-		return -ENOMEM;
-	}
-
-	if (IS_ENABLED(CONFIG_DOWNLOADER_LOG_HEADERS)) {
-		LOG_HEXDUMP_DBG(dl->cfg.buf, len, "HTTP request");
-	}
-
-	LOG_DBG("http request:\n%s", dl->cfg.buf);
-
-	err = dl_socket_send(http->sock.fd, dl->cfg.buf, len);
-	if (err) {
-		LOG_ERR("Failed to send HTTP request, errno %d", errno);
-		return err;
-	}
-
-	return 0;
+	return http_request_send(dl, len);
 }
 
 /* Returns:
@@ -601,6 +687,9 @@ static int dl_http_close(struct downloader *dl)
 static int dl_http_download(struct downloader *dl)
 {
 	int ret, recv_len, data_len, expected_len;
+	size_t remaining;
+	size_t extra_len = 0;
+	bool buffered = false;
 	struct transport_params_http *http;
 
 	http = (struct transport_params_http *)dl->transport_internal;
@@ -618,13 +707,32 @@ static int dl_http_download(struct downloader *dl)
 		http->new_data_req = false;
 	}
 
+	if (http->pipeline.buffered) {
+		/* Parse the pipelined response that is already in the buffer
+		 * before waiting for more data.
+		 */
+		http->pipeline.buffered = false;
+		buffered = true;
+	} else if (http_pipeline_active(dl) && (dl->buf_offset == 0)) {
+		/* The buffer is empty, so it can be used to build the requests. */
+		ret = http_pipeline_fill(dl);
+		if (ret) {
+			LOG_DBG("Pipelined data_req failed, err %d", ret);
+			return -ECONNRESET;
+		}
+	}
+
 	__ASSERT(dl->buf_offset < dl->cfg.buf_size, "Buffer overflow");
 
-	LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
-		(void *)(dl->cfg.buf + dl->buf_offset));
+	if (buffered) {
+		recv_len = 0;
+	} else {
+		LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
+			(void *)(dl->cfg.buf + dl->buf_offset));
 
-	recv_len = dl_socket_recv(http->sock.fd, dl->cfg.buf + dl->buf_offset,
-			     dl->cfg.buf_size - dl->buf_offset);
+		recv_len = dl_socket_recv(http->sock.fd, dl->cfg.buf + dl->buf_offset,
+					  dl->cfg.buf_size - dl->buf_offset);
+	}
 
 	if (recv_len < 0) {
 		if (recv_len == -EMSGSIZE && dl->host_cfg.range_override) {
@@ -652,13 +760,24 @@ static int dl_http_download(struct downloader *dl)
 		return data_len;
 	}
 
-	expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, dl->file_size - dl->progress);
+	remaining = dl->file_size - dl->progress;
+	if (http_pipeline_active(dl)) {
+		/* Data past the end of the current response belongs to the next one. */
+		remaining = MIN(remaining, dl->host_cfg.range_override - http->ranged_progress);
+		if (data_len > remaining) {
+			extra_len = data_len - remaining;
+			data_len = remaining;
+		}
+	}
+
+	expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, remaining);
 
 	if (data_len < expected_len) {
 		/* Wait for more data after the HTTP headers,
 		 * so we don't end up forwarding too small chunks to FOTA library.
 		 */
-		return recv_len > 0 ? 0 : -ECONNRESET; /* Fail if closed while expecting more */
+		/* Fail if closed while expecting more */
+		return (recv_len > 0 || buffered) ? 0 : -ECONNRESET;
 	}
 
 	/* Accumulate progress */
@@ -668,8 +787,12 @@ static int dl_http_download(struct downloader *dl)
 	}
 	if (http->ranged) {
 		http->ranged_progress += data_len;
-		if (http->ranged_progress < dl->host_cfg.range_override) {
+		if ((http->ranged_progress < dl->host_cfg.range_override) &&
+		    (dl->progress < dl->file_size)) {
 			/* Ranged query: read until a full fragment is received */
+		} else if (http_pipeline_active(dl)) {
+			/* Ranged query: next fragment is already requested */
+			http_pipeline_response_done(dl);
 		} else {
 			/* Ranged query: request next fragment */
 			http->new_data_req = true;
@@ -680,13 +803,19 @@ static int dl_http_download(struct downloader *dl)
 		dl->complete = true;
 		http->new_data_req = true;
 	}
-	dl->buf_offset = 0;
+
+	if (extra_len) {
+		/* Keep the beginning of the next pipelined response. */
+		memmove(dl->cfg.buf, dl->cfg.buf + data_len, extra_len);
+		http->pipeline.buffered = true;
+	}
+	dl->buf_offset = extra_len;
 
 	if (dl->complete) {
 		return 0;
 	}
 	/* Continue reading, unless connection is closed */
-	return recv_len > 0 ? 0 : -ECONNRESET;
+	return (recv_len > 0 || buffered) ? 0 : -ECONNRESET;
 }
 
 static const struct dl_transport dl_transport_http = {
@@ -244,6 +244,40 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 			 enum coap_content_format fmt, bool reliable,
 			 coap_client_response_cb_t cb, void *user);
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+/**@brief Start a confirmable CoAP request without waiting for the response.
+ *
+ * The payload is copied, so @p buf can be reused as soon as the function returns.
+ * Response blocks are passed to @p cb as they arrive, and @p done_cb is called once
+ * when the request has completed, failed or been cancelled. Both callbacks are called
+ * from the CoAP client thread.
+ *
+ * @param method CoAP method of the request.
+ * @param resource String containing the specific CoAP endpoint to access.
+ * @param query Optional string containing REST-style query parameters.
+ * @param buf Optional pointer to buffer containing a payload to include with the request.
+ * @param len Length of payload or 0 if none.
+ * @param fmt_out CoAP content format for the Content-Format message option of the payload.
+ * @param fmt_in CoAP content format for the Accept message option of the returned payload.
+ * @param response_expected True to add the Accept option with @p fmt_in.
+ * @param cb Optional pointer to a callback function to receive the response payload.
+ * @param done_cb Pointer to a callback function called when the request has completed.
+ * @param user Pointer to user-specific data to be passed back to the callbacks.
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval -EAGAIN Maximum number of requests are already in flight.
+ * @retval -EMSGSIZE Payload is larger than CONFIG_NRF_CLOUD_COAP_ASYNC_PAYLOAD_SIZE.
+ * @return 0 if the request was sent, otherwise a negative error number.
+ */
+int nrf_cloud_coap_request_async(enum coap_method method,
+				 const char *resource, const char *query,
+				 const uint8_t *buf, size_t len,
+				 enum coap_content_format fmt_out,
+				 enum coap_content_format fmt_in,
+				 bool response_expected,
+				 coap_client_response_cb_t cb,
+				 nrf_cloud_coap_done_cb_t done_cb, void *user);
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 /**
  * @brief Send binary log data to nRF Cloud on the /msg/d2c/bin topic. The data sent should
  * come from the nrf_cloud_log_backend. It will be assembled in sequential order and made
@@ -340,6 +340,37 @@ int nrf_cloud_coap_sensor_send(const char *app_id, double value, int64_t ts_ms,
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+int nrf_cloud_coap_sensor_send_async(const char *app_id, double value, int64_t ts_ms,
+				     nrf_cloud_coap_done_cb_t done_cb, void *user)
+{
+	__ASSERT_NO_MSG(app_id != NULL);
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+	int64_t ts = (ts_ms == NRF_CLOUD_NO_TIMESTAMP) ? get_ts() : ts_ms;
+	/* The payload is copied by the transport, so a stack buffer is sufficient */
+	uint8_t buffer[SENSOR_SEND_CBOR_MAX_SIZE];
+	size_t len = sizeof(buffer);
+	int err;
+
+	err = coap_codec_sensor_encode(app_id, value, ts, buffer, &len,
+				       COAP_CONTENT_FORMAT_APP_CBOR);
+	if (err) {
+		LOG_ERR("Unable to encode sensor data: %d", err);
+		return err;
+	}
+	err = nrf_cloud_coap_request_async(COAP_METHOD_POST, COAP_D2C_RSC, NULL, buffer, len,
+					   COAP_CONTENT_FORMAT_APP_CBOR,
+					   COAP_CONTENT_FORMAT_APP_CBOR, false,
+					   NULL, done_cb, user);
+	if (err && (err != -EAGAIN)) {
+		LOG_ERR("Failed to send POST request: %d", err);
+	}
+	return err;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 int nrf_cloud_coap_message_send(const char *app_id, const char *message, bool json, int64_t ts_ms,
 				bool confirmable)
 {
@@ -400,6 +431,62 @@ int nrf_cloud_coap_json_message_send(const char *message, bool bulk, bool confir
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+/* JSON array of messages waiting for nrf_cloud_coap_batch_flush() */
+static K_MUTEX_DEFINE(batch_mut);
+static char batch_buf[CONFIG_NRF_CLOUD_COAP_ASYNC_PAYLOAD_SIZE];
+static size_t batch_len;
+
+int nrf_cloud_coap_json_message_batch_add(const char *message)
+{
+	__ASSERT_NO_MSG(message != NULL);
+
+	size_t msg_len = strlen(message);
+	int err = 0;
+
+	k_mutex_lock(&batch_mut, K_FOREVER);
+	/* Leading '[' or ',' for this message and the closing ']' added on flush */
+	if ((batch_len + 1 + msg_len + 1) > sizeof(batch_buf)) {
+		err = -ENOMEM;
+	} else {
+		batch_buf[batch_len] = batch_len ? ',' : '[';
+		memcpy(&batch_buf[batch_len + 1], message, msg_len);
+		batch_len += 1 + msg_len;
+	}
+	k_mutex_unlock(&batch_mut);
+
+	return err;
+}
+
+int nrf_cloud_coap_batch_flush(nrf_cloud_coap_done_cb_t done_cb, void *user)
+{
+	int err;
+
+	k_mutex_lock(&batch_mut, K_FOREVER);
+	if (!batch_len) {
+		err = -ENODATA;
+		goto unlock;
+	}
+
+	batch_buf[batch_len] = ']';
+	err = nrf_cloud_coap_request_async(COAP_METHOD_POST, COAP_D2C_BULK_RSC, NULL,
+					   (const uint8_t *)batch_buf, batch_len + 1,
+					   COAP_CONTENT_FORMAT_APP_JSON,
+					   COAP_CONTENT_FORMAT_APP_JSON, false,
+					   NULL, done_cb, user);
+	if (!err) {
+		/* The transport owns a copy of the payload now */
+		batch_len = 0;
+	} else if (err != -EAGAIN) {
+		LOG_ERR("Failed to send POST request: %d", err);
+	}
+
+unlock:
+	k_mutex_unlock(&batch_mut);
+	return err;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 int nrf_cloud_coap_location_send(const struct nrf_cloud_gnss_data *gnss, bool confirmable)
 {
 	__ASSERT_NO_MSG(gnss != NULL);
@@ -746,6 +833,29 @@ int nrf_cloud_coap_shadow_desired_update(const char * const shadow_json)
 	return shadow_update(COAP_SHDW_DES_RSC, shadow_json);
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+int nrf_cloud_coap_shadow_state_update_async(const char * const shadow_json,
+					     nrf_cloud_coap_done_cb_t done_cb, void *user)
+{
+	int err;
+
+	__ASSERT_NO_MSG(shadow_json != NULL);
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	err = nrf_cloud_coap_request_async(COAP_METHOD_PATCH, COAP_SHDW_REP_RSC, NULL,
+					   (const uint8_t *)shadow_json, strlen(shadow_json),
+					   COAP_CONTENT_FORMAT_APP_JSON,
+					   COAP_CONTENT_FORMAT_APP_JSON, false,
+					   NULL, done_cb, user);
+	if (err && (err != -EAGAIN)) {
+		LOG_ERR("Failed to send PATCH request: %d", err);
+	}
+	return err;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 int nrf_cloud_coap_shadow_device_status_update(const struct nrf_cloud_device_status
 					       *const dev_status)
 {
@@ -62,12 +62,20 @@ struct cc_xfer_data {
 	int result_code;
 	struct k_sem *sem;
 	atomic_t used;
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	/* Set for asynchronous transfers, which own the xfer until completion */
+	nrf_cloud_coap_done_cb_t done_cb;
+	/* Copy of the payload of an asynchronous transfer, from async_payload_slab */
+	uint8_t *payload;
+#endif
 };
 
 /* Semaphore to be used with internal coap_client requests */
 static K_SEM_DEFINE(cb_sem, 0, 1);
 /* Semaphore to be used when doing authorization with an external coap_client */
 static K_SEM_DEFINE(ext_cc_sem, 0, 1);
+/* Semaphore given whenever a transfer ends, to wake up requests waiting for a free slot */
+static K_SEM_DEFINE(xfer_done_sem, 0, 1);
 /* Mutex to be used when using the internal coap_client */
 static K_MUTEX_DEFINE(internal_transfer_mut);
 
@@ -125,6 +133,15 @@ static const char *fmt_name(enum coap_content_format fmt)
  */
 static struct cc_xfer_data xfer_ctx_pool[MAX_XFERS];
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+/* Payload copies of asynchronous transfers. Only asynchronous transfers need one, and at most
+ * CONFIG_COAP_CLIENT_MAX_REQUESTS of them can be in flight on the internal client.
+ */
+K_MEM_SLAB_DEFINE_STATIC(async_payload_slab,
+			 ROUND_UP(CONFIG_NRF_CLOUD_COAP_ASYNC_PAYLOAD_SIZE, 4),
+			 CONFIG_COAP_CLIENT_MAX_REQUESTS, 4);
+#endif
+
 static struct cc_xfer_data *xfer_ctx_take(void)
 {
 	for (int i = 0; i < ARRAY_SIZE(xfer_ctx_pool); i++) {
@@ -150,7 +167,6 @@ static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 	struct cc_xfer_data *xfer = xfer_ctx_take();
 
 	if (!xfer) {
-		LOG_ERR("Maximum number of CoAP transfers are already in progress");
 		return NULL;
 	}
 	xfer->nrfc_cc = cc;
@@ -158,6 +174,10 @@ static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 	xfer->user_data = user;
 	xfer->result_code = -ECANCELED;
 	xfer->sem = sem;
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	xfer->done_cb = NULL;
+	xfer->payload = NULL;
+#endif
 	return xfer;
 }
 
@@ -459,11 +479,41 @@ int nrf_cloud_coap_shadow_network_info_update(void)
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+static void async_xfer_release(struct cc_xfer_data *xfer)
+{
+	if (xfer->payload) {
+		k_mem_slab_free(&async_payload_slab, xfer->payload);
+		xfer->payload = NULL;
+	}
+	xfer->done_cb = NULL;
+	xfer_ctx_release(xfer);
+}
+
+static void async_xfer_complete(struct cc_xfer_data *xfer)
+{
+	nrf_cloud_coap_done_cb_t done_cb = xfer->done_cb;
+	void *user = xfer->user_data;
+	int result = xfer->result_code;
+
+	/* Same convention as the blocking API: 0 on success, positive CoAP result
+	 * code if rejected by the cloud, negative errno on device-side failure.
+	 */
+	if ((result >= 0) && (result < COAP_RESPONSE_CODE_BAD_REQUEST)) {
+		result = 0;
+	}
+
+	async_xfer_release(xfer);
+	done_cb(result, user);
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 static void client_callback(const struct coap_client_response_data *data, void *user_data)
 {
 	__ASSERT_NO_MSG(user_data != NULL);
 
 	struct cc_xfer_data *xfer = (struct cc_xfer_data *)user_data;
+	bool done = data->last_block || (data->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST);
 
 	if (data->result_code >= 0) {
 		LOG_CB_DBG(data->result_code, data->offset, data->payload_len, data->last_block);
@@ -490,34 +540,42 @@ static void client_callback(const struct coap_client_response_data *data, void *
 			xfer->cb(data, xfer->user_data);
 		}
 	}
-	if (data->last_block || (data->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	if (xfer->done_cb && (data->result_code < 0)) {
+		/* Nobody cancels an asynchronous transfer on error, so end it here */
+		done = true;
+	}
+#endif
+	if (done) {
 		LOG_DBG("End of client transfer");
 		if (xfer->sem) {
 			k_sem_give(xfer->sem);
 		}
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+		if (xfer->done_cb) {
+			async_xfer_complete(xfer);
+		}
+#endif
+		k_sem_give(&xfer_done_sem);
 	}
 }
 
 
 BUILD_ASSERT((NRF_CLOUD_COAP_NUM_INTERNAL_OPTIONS + CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS) <=
 		CONFIG_COAP_CLIENT_MAX_EXTRA_OPTIONS);
-static int client_transfer(enum coap_method method,
-			   const char *resource, const char *query,
-			   const uint8_t *buf, size_t buf_len,
-			   enum coap_content_format fmt_out,
-			   enum coap_content_format fmt_in,
-			   bool response_expected,
-			   bool reliable,
-			   struct cc_xfer_data *xfer)
+static int client_request_build(struct coap_client_request *const request,
+				enum coap_method method,
+				const char *resource, const char *query,
+				const uint8_t *buf, size_t buf_len,
+				enum coap_content_format fmt_out,
+				enum coap_content_format fmt_in,
+				bool response_expected,
+				bool reliable,
+				struct cc_xfer_data *xfer)
 {
-	if (xfer == NULL) {
-		return -ENOBUFS;
-	}
-	__ASSERT_NO_MSG(resource != NULL);
+	int err;
 
-	int err = 0;
-	int retry;
-	struct coap_client_request request = {
+	*request = (struct coap_client_request) {
 		.method = method,
 		.confirmable = reliable,
 		.fmt = fmt_out,
@@ -526,12 +584,11 @@ static int client_transfer(enum coap_method method,
 		.cb = client_callback,
 		.user_data = xfer
 	};
-	struct coap_client *const cc = &xfer->nrfc_cc->cc;
 
 	size_t num_internal_options = 0;
 	if (response_expected) {
 		num_internal_options += 1;
-		request.options[0] = (struct coap_client_option) {
+		request->options[0] = (struct coap_client_option) {
 			.code = COAP_OPTION_ACCEPT,
 			.len = 1,
 			.value[0] = fmt_in
@@ -540,34 +597,63 @@ static int client_transfer(enum coap_method method,
 
 	size_t num_user_options = CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS;
 #if (CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS > 0)
-	nrf_cloud_coap_get_user_options(&request.options[num_internal_options], &num_user_options,
+	nrf_cloud_coap_get_user_options(&request->options[num_internal_options], &num_user_options,
 		resource, xfer->user_data);
 #endif
 	const size_t total_options = num_internal_options + num_user_options;
 
-	request.num_options = total_options;
+	request->num_options = total_options;
 
 	if (!query) {
-		strncpy(request.path, resource, MAX_PATH_SIZE);
-		request.path[MAX_PATH_SIZE - 1] = '\0';
+		strncpy(request->path, resource, MAX_PATH_SIZE);
+		request->path[MAX_PATH_SIZE - 1] = '\0';
 	} else {
-		err = snprintk(request.path, sizeof(request.path), "%s?%s", resource, query);
-		if ((err <= 0) || (err >= sizeof(request.path))) {
+		err = snprintk(request->path, sizeof(request->path), "%s?%s", resource, query);
+		if ((err <= 0) || (err >= sizeof(request->path))) {
 			/* If we get here, CONFIG_COAP_CLIENT_MAX_PATH_LENGTH needs a bump */
 			LOG_ERR("Could not format string: %s?%s", resource, query);
-			err = -ETXTBSY;
-			goto transfer_end;
+			return -ETXTBSY;
 		}
 	}
 
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
 	LOG_DBG("%s %s %s Content-Format:%s, %zd bytes out, Accept:%s", reliable ? "CON" : "NON",
-		METHOD_NAME(method), request.path, fmt_name(fmt_out), buf_len,
+		METHOD_NAME(method), request->path, fmt_name(fmt_out), buf_len,
 		response_expected ? fmt_name(fmt_in) : "none");
 #endif /* CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG */
 
+	return 0;
+}
+
+static int client_transfer(enum coap_method method,
+			   const char *resource, const char *query,
+			   const uint8_t *buf, size_t buf_len,
+			   enum coap_content_format fmt_out,
+			   enum coap_content_format fmt_in,
+			   bool response_expected,
+			   bool reliable,
+			   struct cc_xfer_data *xfer)
+{
+	if (xfer == NULL) {
+		LOG_ERR("Maximum number of CoAP transfers are already in progress");
+		return -ENOBUFS;
+	}
+	__ASSERT_NO_MSG(resource != NULL);
+
+	int err;
+	int retry;
+	struct coap_client_request request;
+	struct coap_client *const cc = &xfer->nrfc_cc->cc;
+
+	err = client_request_build(&request, method, resource, query, buf, buf_len,
+				   fmt_out, fmt_in, response_expected, reliable, xfer);
+	if (err) {
+		goto transfer_end;
+	}
+
 	retry = 0;
 	k_sem_reset(xfer->sem);
+	k_sem_reset(&xfer_done_sem);
 	while ((xfer->nrfc_cc->sock >= 0) &&
 	       (err = coap_client_req(cc, xfer->nrfc_cc->sock, NULL, &request, NULL)) == -EAGAIN) {
 		if (!nrf_cloud_coap_is_connected()) {
@@ -583,7 +669,8 @@ static int client_transfer(enum coap_method method,
 			goto transfer_end;
 		}
 		LOG_DBG("CoAP client busy");
-		k_sleep(K_MSEC(500));
+		/* Retry as soon as another transfer ends, or after 500 ms at the latest */
+		(void)k_sem_take(&xfer_done_sem, K_MSEC(500));
 	}
 
 	if (err < 0) {
@@ -732,6 +819,73 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+int nrf_cloud_coap_request_async(enum coap_method method,
+				 const char *resource, const char *query,
+				 const uint8_t *buf, size_t len,
+				 enum coap_content_format fmt_out,
+				 enum coap_content_format fmt_in,
+				 bool response_expected,
+				 coap_client_response_cb_t cb,
+				 nrf_cloud_coap_done_cb_t done_cb, void *user)
+{
+	__ASSERT_NO_MSG(resource != NULL);
+
+	struct coap_client_request request;
+	struct cc_xfer_data *xfer;
+	int err;
+
+	if (!done_cb) {
+		return -EINVAL;
+	}
+	if (len > CONFIG_NRF_CLOUD_COAP_ASYNC_PAYLOAD_SIZE) {
+		return -EMSGSIZE;
+	}
+	if (!nrf_cloud_coap_is_connected() || (internal_cc.sock < 0)) {
+		return -EACCES;
+	}
+
+	/* The internal transfer mutex is not taken, so asynchronous requests can be started
+	 * while a blocking transfer is waiting for its response; coap_client serializes
+	 * access to its own request slots.
+	 */
+	xfer = xfer_data_init(&internal_cc, cb, user, NULL);
+	if (!xfer) {
+		LOG_DBG("Maximum number of CoAP transfers are already in progress");
+		return -EAGAIN;
+	}
+	xfer->done_cb = done_cb;
+	if (len) {
+		if (k_mem_slab_alloc(&async_payload_slab, (void **)&xfer->payload, K_NO_WAIT)) {
+			LOG_DBG("No free payload buffer");
+			async_xfer_release(xfer);
+			return -EAGAIN;
+		}
+		memcpy(xfer->payload, buf, len);
+	}
+
+	err = client_request_build(&request, method, resource, query, xfer->payload, len,
+				   fmt_out, fmt_in, response_expected, true, xfer);
+	if (!err) {
+		err = coap_client_req(&internal_cc.cc, internal_cc.sock, NULL, &request, NULL);
+	}
+	if (err) {
+		if (err == -EAGAIN) {
+			LOG_DBG("CoAP client busy");
+		} else {
+			LOG_ERR("Error sending CoAP request: %d", err);
+		}
+		async_xfer_release(xfer);
+		return err;
+	}
+
+	if (len) {
+		LOG_HEXDUMP_DBG(xfer->payload, MIN(64, len), "Sent");
+	}
+	return 0;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 static void auth_cb(const struct coap_client_response_data *data, void *user_data)
 {
 	struct nrf_cloud_coap_client *client = (struct nrf_cloud_coap_client *)user_data;
@@ -266,6 +266,29 @@ int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 int nrf_cloud_wifi_req_json_encode(struct wifi_scan_info const *const wifi,
 				   cJSON *const req_obj_out);
 
+/** @brief Encode a complete location request message as JSON directly into the provided buffer.
+ *
+ * Produces the same message as @ref nrf_cloud_obj_location_request_create_timestamped followed
+ * by encoding, without building a cJSON tree on the heap.
+ *
+ * @param[in]     cells_inf Cellular network information, or NULL.
+ * @param[in]     wifi_inf Wi-Fi network information, or NULL.
+ * @param[in]     config Optional location request configuration, or NULL.
+ * @param[in]     timestamp Timestamp to include, or 0 to omit.
+ * @param[out]    buf Buffer for the NUL-terminated JSON string.
+ * @param[in,out] buf_len Size of @p buf on input; length of the string on output.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ * @retval -EDOM Too few Wi-Fi networks, see NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN.
+ * @retval -ENODATA No usable cellular or Wi-Fi data.
+ * @retval -ENOMEM Buffer is too small.
+ */
+int nrf_cloud_location_req_json_buf_encode(struct lte_lc_cells_info const *const cells_inf,
+					   struct wifi_scan_info const *const wifi_inf,
+					   struct nrf_cloud_location_config const *const config,
+					   int64_t timestamp, char *const buf, size_t *const buf_len);
+
 /** @brief Get the required information from the modem for a single-cell location request. */
 int nrf_cloud_get_single_cell_modem_info(struct lte_lc_cell *const cell_inf);
 
@@ -11,6 +11,7 @@
 #include <net/nrf_cloud_location.h>
 #include <net/nrf_cloud_log.h>
 #include <zephyr/logging/log_output.h>
+#include <stdarg.h>
 #include <stdbool.h>
 #include <string.h>
 #include <stdio.h>
@@ -2256,6 +2257,398 @@ cleanup:
 	return err;
 }
 
+/* Writer for encoding JSON directly into a caller-provided buffer, without building
+ * a cJSON tree first. Once an error has occurred, all further writes are ignored and
+ * the error is reported when the encoding is done.
+ */
+struct json_stream {
+	char *buf;
+	size_t size;
+	size_t len;
+	int err;
+};
+
+static void js_raw(struct json_stream *const js, const char *const str, size_t str_len)
+{
+	if (js->err) {
+		return;
+	}
+	/* Always keep room for the NUL terminator */
+	if ((js->len + str_len) >= js->size) {
+		js->err = -ENOMEM;
+		return;
+	}
+	memcpy(&js->buf[js->len], str, str_len);
+	js->len += str_len;
+	js->buf[js->len] = '\0';
+}
+
+static void js_printf(struct json_stream *const js, const char *const fmt, ...)
+{
+	va_list args;
+	int ret;
+
+	if (js->err) {
+		return;
+	}
+
+	va_start(args, fmt);
+	ret = vsnprintk(&js->buf[js->len], js->size - js->len, fmt, args);
+	va_end(args);
+
+	if ((ret < 0) || ((js->len + ret) >= js->size)) {
+		js->err = -ENOMEM;
+		js->buf[js->len] = '\0';
+		return;
+	}
+	js->len += ret;
+}
+
+/* Add a separator unless this is the first item of an object or array, or a value */
+static void js_sep(struct json_stream *const js)
+{
+	if (!js->err && js->len && !strchr("{[:", js->buf[js->len - 1])) {
+		js_raw(js, ",", 1);
+	}
+}
+
+static void js_key(struct json_stream *const js, const char *const key)
+{
+	js_sep(js);
+	js_printf(js, "\"%s\":", key);
+}
+
+static void js_open(struct json_stream *const js, const char *const key, char bracket)
+{
+	if (key) {
+		js_key(js, key);
+	} else {
+		js_sep(js);
+	}
+	js_raw(js, &bracket, 1);
+}
+
+static void js_close(struct json_stream *const js, char bracket)
+{
+	js_raw(js, &bracket, 1);
+}
+
+static void js_int(struct json_stream *const js, const char *const key, int64_t val)
+{
+	js_key(js, key);
+	js_printf(js, "%lld", (long long)val);
+}
+
+/* Values such as RSRQ have a resolution of 0.5 dB; print them without float support */
+static void js_half_int(struct json_stream *const js, const char *const key, int halves)
+{
+	int whole = halves / 2;
+
+	js_key(js, key);
+	if (halves % 2) {
+		js_printf(js, "%s%d.5", ((halves < 0) && (whole == 0)) ? "-" : "", whole);
+	} else {
+		js_printf(js, "%d", whole);
+	}
+}
+
+static void js_bool(struct json_stream *const js, const char *const key, bool val)
+{
+	js_key(js, key);
+	js_printf(js, "%s", val ? "true" : "false");
+}
+
+static void js_str(struct json_stream *const js, const char *const key,
+		   const char *const str, size_t str_len)
+{
+	js_key(js, key);
+	js_raw(js, "\"", 1);
+	for (size_t i = 0; i < str_len; i++) {
+		const char c = str[i];
+
+		if ((c == '"') || (c == '\\')) {
+			js_raw(js, "\\", 1);
+			js_raw(js, &c, 1);
+		} else if ((uint8_t)c < 0x20) {
+			js_printf(js, "\\u%04x", (uint8_t)c);
+		} else {
+			js_raw(js, &c, 1);
+		}
+	}
+	js_raw(js, "\"", 1);
+}
+
+static void lte_inf_json_stream(struct json_stream *const js,
+				struct lte_lc_cell const *const inf)
+{
+	/* Required parameters for the API call */
+	js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_ECI, inf->id);
+	js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_MCC, inf->mcc);
+	js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_MNC, inf->mnc);
+	js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_TAC, inf->tac);
+
+	/* Optional parameters for the API call */
+	if (inf->earfcn != NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN) {
+		js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN, inf->earfcn);
+	}
+	if (inf->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) {
+		js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP, RSRP_IDX_TO_DBM(inf->rsrp));
+	}
+	if (inf->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) {
+		js_half_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+			    (int)(RSRQ_IDX_TO_DB(inf->rsrq) * 2));
+	}
+	if (inf->timing_advance != NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV) {
+		js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_T_ADV,
+		       MIN(inf->timing_advance, NRF_CLOUD_LOCATION_CELL_TIME_ADV_MAX));
+	}
+}
+
+static void ncells_json_stream(struct json_stream *const js, const uint8_t ncells_count,
+			       const struct lte_lc_ncell *const neighbor_cells)
+{
+	js_open(js, NRF_CLOUD_CELL_POS_JSON_KEY_NBORS, '[');
+	for (uint8_t i = 0; i < ncells_count; ++i) {
+		const struct lte_lc_ncell *ncell = neighbor_cells + i;
+
+		js_open(js, NULL, '{');
+		/* Required parameters for the API call */
+		js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN, ncell->earfcn);
+		js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_PCI, ncell->phys_cell_id);
+
+		/* Optional parameters for the API call */
+		if (ncell->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) {
+			js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP, RSRP_IDX_TO_DBM(ncell->rsrp));
+		}
+		if (ncell->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) {
+			js_half_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+				    (int)(RSRQ_IDX_TO_DB(ncell->rsrq) * 2));
+		}
+		if (ncell->time_diff != LTE_LC_CELL_TIME_DIFF_INVALID) {
+			js_int(js, NRF_CLOUD_CELL_POS_JSON_KEY_TDIFF, ncell->time_diff);
+		}
+		js_close(js, '}');
+	}
+	js_close(js, ']');
+}
+
+/* Streaming counterpart of nrf_cloud_cell_pos_req_json_encode() */
+static int cell_pos_req_json_stream(struct json_stream *const js,
+				    struct lte_lc_cells_info const *const inf)
+{
+	const bool current_valid = (inf->current_cell.id != LTE_LC_CELL_EUTRAN_ID_INVALID);
+
+	if (!current_valid && (!inf->gci_cells_count || !inf->gci_cells)) {
+		return -ENODATA;
+	}
+
+	js_open(js, NRF_CLOUD_CELL_POS_JSON_KEY_LTE, '[');
+
+	if (current_valid) {
+		js_open(js, NULL, '{');
+		lte_inf_json_stream(js, &inf->current_cell);
+		if (inf->ncells_count && inf->neighbor_cells) {
+			ncells_json_stream(js, inf->ncells_count, inf->neighbor_cells);
+		}
+		js_close(js, '}');
+	}
+
+	for (uint8_t i = 0; inf->gci_cells && (i < inf->gci_cells_count); ++i) {
+		js_open(js, NULL, '{');
+		lte_inf_json_stream(js, inf->gci_cells + i);
+		js_close(js, '}');
+	}
+
+	js_close(js, ']');
+
+	return js->err;
+}
+
+/* Streaming counterpart of nrf_cloud_wifi_req_json_encode() */
+static int wifi_req_json_stream(struct json_stream *const js,
+				struct wifi_scan_info const *const wifi)
+{
+	if (!wifi->ap_info || !wifi->cnt) {
+		return -EINVAL;
+	}
+
+	int encoded_cnt = 0;
+	const bool add_all = IS_ENABLED(CONFIG_NRF_CLOUD_WIFI_LOCATION_ENCODE_OPT_ALL);
+	const bool add_rssi =
+		(add_all || IS_ENABLED(CONFIG_NRF_CLOUD_WIFI_LOCATION_ENCODE_OPT_MAC_RSSI));
+
+	js_open(js, NRF_CLOUD_LOCATION_JSON_KEY_WIFI, '{');
+	js_open(js, NRF_CLOUD_LOCATION_JSON_KEY_APS, '[');
+
+	for (uint8_t cnt = 0; cnt < wifi->cnt; ++cnt) {
+		char mac_str[WIFI_MAC_ADDR_STR_LEN + 1];
+		struct wifi_scan_result const *const ap = (wifi->ap_info + cnt);
+
+		if (is_local_mac(ap->mac)) {
+			continue;
+		}
+
+		/* MAC address is the only required parameter for the API call */
+		if (snprintk(mac_str, sizeof(mac_str), WIFI_MAC_ADDR_TEMPLATE, ap->mac[0],
+			     ap->mac[1], ap->mac[2], ap->mac[3], ap->mac[4],
+			     ap->mac[5]) != WIFI_MAC_ADDR_STR_LEN) {
+			return -EINVAL;
+		}
+
+		js_open(js, NULL, '{');
+		js_str(js, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_MAC, mac_str, WIFI_MAC_ADDR_STR_LEN);
+
+		/* Optional parameters for the API call */
+		if (add_rssi && (ap->rssi != NRF_CLOUD_LOCATION_WIFI_OMIT_RSSI)) {
+			js_int(js, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_RSSI, ap->rssi);
+		}
+		if (add_all) {
+			size_t ssid_len = 0;
+
+			if ((ap->ssid_length > 0) && (ap->ssid_length <= WIFI_SSID_MAX_LEN)) {
+				ssid_len = strnlen((const char *)ap->ssid, ap->ssid_length);
+			}
+			if (ssid_len) {
+				js_str(js, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_SSID,
+				       (const char *)ap->ssid, ssid_len);
+			}
+			if (ap->channel != NRF_CLOUD_LOCATION_WIFI_OMIT_CHAN) {
+				js_int(js, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_CH, ap->channel);
+			}
+		}
+		js_close(js, '}');
+		++encoded_cnt;
+	}
+
+	js_close(js, ']');
+	js_close(js, '}');
+
+	if (js->err) {
+		return js->err;
+	}
+
+	return (encoded_cnt < NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN) ? -ENODATA : 0;
+}
+
+int nrf_cloud_location_req_json_buf_encode(struct lte_lc_cells_info const *const cells_inf,
+					   struct wifi_scan_info const *const wifi_inf,
+					   struct nrf_cloud_location_config const *const config,
+					   int64_t timestamp, char *const buf, size_t *const buf_len)
+{
+	if ((!cells_inf && !wifi_inf) || !buf || !buf_len || !*buf_len) {
+		return -EINVAL;
+	}
+	if (!cells_inf && (wifi_inf->cnt < NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN)) {
+		return -EDOM;
+	}
+
+	struct json_stream js = {
+		.buf = buf,
+		.size = *buf_len,
+	};
+	bool cell_inf_added = false;
+	bool cell_inf_excluded = false;
+	bool wifi_inf_excluded = false;
+	size_t mark;
+	int err = 0;
+
+	buf[0] = '\0';
+	js_open(&js, NULL, '{');
+	js_str(&js, NRF_CLOUD_JSON_APPID_KEY, NRF_CLOUD_JSON_APPID_VAL_LOCATION,
+	       strlen(NRF_CLOUD_JSON_APPID_VAL_LOCATION));
+	js_str(&js, NRF_CLOUD_JSON_MSG_TYPE_KEY, NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA,
+	       strlen(NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA));
+
+	if (config && ((config->do_reply != NRF_CLOUD_LOCATION_DOREPLY_DEFAULT) ||
+		       (config->hi_conf != NRF_CLOUD_LOCATION_HICONF_DEFAULT) ||
+		       (config->fallback != NRF_CLOUD_LOCATION_FALLBACK_DEFAULT))) {
+		js_open(&js, NRF_CLOUD_LOCATION_JSON_KEY_CONFIG, '{');
+		if (config->do_reply != NRF_CLOUD_LOCATION_DOREPLY_DEFAULT) {
+			js_bool(&js, NRF_CLOUD_LOCATION_JSON_KEY_DOREPLY, config->do_reply);
+		}
+		if (config->hi_conf != NRF_CLOUD_LOCATION_HICONF_DEFAULT) {
+			js_bool(&js, NRF_CLOUD_LOCATION_JSON_KEY_HICONF, config->hi_conf);
+		}
+		if (config->fallback != NRF_CLOUD_LOCATION_FALLBACK_DEFAULT) {
+			js_bool(&js, NRF_CLOUD_LOCATION_JSON_KEY_FALLBACK, config->fallback);
+		}
+		js_close(&js, '}');
+	}
+
+	js_open(&js, NRF_CLOUD_JSON_DATA_KEY, '{');
+
+	/* Same rules as nrf_cloud_obj_location_request_payload_add(); a section that
+	 * turns out to have too little data is rolled back.
+	 */
+	if (cells_inf) {
+		mark = js.len;
+		err = cell_pos_req_json_stream(&js, cells_inf);
+		if ((err == -ENODATA) && (wifi_inf != NULL)) {
+			cell_inf_excluded = true;
+			js.len = mark;
+			buf[js.len] = '\0';
+		} else if (err) {
+			goto done;
+		}
+		cell_inf_added = (err == 0);
+	}
+
+	if (wifi_inf) {
+		mark = js.len;
+		err = wifi_req_json_stream(&js, wifi_inf);
+		if (err == -ENODATA) {
+			wifi_inf_excluded = true;
+			js.len = mark;
+			buf[js.len] = '\0';
+			if (cell_inf_added) {
+				err = 0;
+			}
+		}
+		if (err) {
+			goto done;
+		}
+	}
+
+	js_close(&js, '}');
+
+	if (timestamp) {
+		js_int(&js, NRF_CLOUD_MSG_TIMESTAMP_KEY, timestamp);
+	}
+
+	js_close(&js, '}');
+	err = js.err;
+
+done:
+	/* A request that does not fit is encoded again with cJSON, which warns about the
+	 * excluded data itself.
+	 */
+	if (err != -ENOMEM) {
+		if (cell_inf_excluded) {
+			LOG_WRN("No GCI cells, excluding cellular data from request");
+		}
+		if (wifi_inf_excluded) {
+			LOG_WRN("At least %d APs (with a non-local MAC address) are required",
+				NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN);
+			if (cell_inf_added) {
+				LOG_WRN("Excluding Wi-Fi data, request is cellular only");
+			}
+		}
+	}
+
+	if (err) {
+		if (err == -ENOMEM) {
+			LOG_DBG("Location request does not fit in %zu bytes", *buf_len);
+		} else {
+			LOG_ERR("Failed to format location request: %d", err);
+		}
+		buf[0] = '\0';
+		*buf_len = 0;
+	} else {
+		*buf_len = js.len;
+	}
+	return err;
+}
+
 static bool json_item_string_exists(const cJSON *const obj, const char *const key,
 				    const char *const val)
 {
@@ -60,8 +60,34 @@ static struct nrf_cloud_log_stats {
 	uint32_t bytes_sent;
 	/** Total number of bytes (before TLS) sent */
 	uint32_t lines_dropped;
+	/** Total number of lines discarded by rate limiting */
+	uint32_t lines_rate_limited;
 } stats;
 
+#if defined(CONFIG_NRF_CLOUD_LOG_RATE_LIMIT)
+/* Token amounts are scaled so that a bucket refills by RATE units per millisecond */
+#define RATE_LIMIT_TOKEN    1000
+#define RATE_LIMIT_CAPACITY (CONFIG_NRF_CLOUD_LOG_RATE_LIMIT_BURST * RATE_LIMIT_TOKEN)
+
+/** Token bucket shared by the log sources mapped to it */
+struct log_rate_bucket {
+	/** Available tokens, scaled by RATE_LIMIT_TOKEN */
+	int64_t tokens;
+	/** Uptime in ms when the bucket was last refilled */
+	int64_t last;
+	/** Bucket has been used, so tokens and last are valid */
+	bool active;
+};
+
+static struct log_rate_bucket rate_buckets[CONFIG_NRF_CLOUD_LOG_RATE_LIMIT_BUCKETS];
+#endif
+
+/* Uptime in ms of the last transfer, and whether the pending batch must be sent without
+ * waiting for the batch interval to expire.
+ */
+static int64_t last_send_time;
+static bool batch_urgent;
+
 /* Information about a log message is stored in the log_context by the logger_process backend
  * function, then used by the logger_out function when encoding messages for transport.
  */
@@ -124,6 +150,16 @@ LOG_OUTPUT_DEFINE(log_nrf_cloud_output, logger_out, log_buf, (sizeof(log_buf) -
 RING_BUF_DECLARE(log_nrf_cloud_rb, RING_BUF_SIZE);
 
 static int send_ring_buffer(void);
+static void log_batch_work_fn(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(log_batch_work, log_batch_work_fn);
+/* Sends the pending batch so that neither the system workqueue nor the logging thread
+ * waits for the network when the batch interval expires.
+ */
+static struct k_work_q log_batch_workq;
+#if CONFIG_NRF_CLOUD_LOG_BATCH_INTERVAL_MS != 0
+static K_THREAD_STACK_DEFINE(log_batch_workq_stack, CONFIG_NRF_CLOUD_LOG_BATCH_THREAD_STACK_SIZE);
+#endif
 
 static void logger_init(const struct log_backend *const backend)
 {
@@ -137,6 +173,13 @@ static void logger_init(const struct log_backend *const backend)
 	}
 	initialized = true;
 
+#if CONFIG_NRF_CLOUD_LOG_BATCH_INTERVAL_MS != 0
+	k_work_queue_init(&log_batch_workq);
+	k_work_queue_start(&log_batch_workq, log_batch_workq_stack,
+			   K_THREAD_STACK_SIZEOF(log_batch_workq_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+#endif
+
 	nrf_cloud_log_init();
 	LOG_INF("nRF Cloud logging mode:%s, level:%d",
 		IS_ENABLED(CONFIG_NRF_CLOUD_LOG_DICTIONARY_LOGGING_ENABLED) ? "dictionary" : "text",
@@ -220,6 +263,48 @@ static int log_msg_filter(uint32_t src_id, int level)
 	return 0;
 }
 
+#if defined(CONFIG_NRF_CLOUD_LOG_RATE_LIMIT)
+static bool log_msg_rate_limited(uint32_t src_id, int level)
+{
+	struct log_rate_bucket *bucket;
+	int64_t now;
+
+	/* Errors are never rate limited */
+	if (level == LOG_LEVEL_ERR) {
+		return false;
+	}
+
+	/* This is only called from the logging thread so no locking is needed */
+	bucket = &rate_buckets[src_id % ARRAY_SIZE(rate_buckets)];
+	now = k_uptime_get();
+
+	/* A bucket starts full so that messages are not throttled at boot */
+	if (!bucket->active) {
+		bucket->active = true;
+		bucket->tokens = RATE_LIMIT_CAPACITY;
+		bucket->last = now;
+	}
+
+	bucket->tokens = MIN(bucket->tokens + (now - bucket->last) *
+					      CONFIG_NRF_CLOUD_LOG_RATE_LIMIT_RATE,
+			     RATE_LIMIT_CAPACITY);
+	bucket->last = now;
+
+	if (bucket->tokens < RATE_LIMIT_TOKEN) {
+		return true;
+	}
+	bucket->tokens -= RATE_LIMIT_TOKEN;
+	return false;
+}
+#else
+static bool log_msg_rate_limited(uint32_t src_id, int level)
+{
+	ARG_UNUSED(src_id);
+	ARG_UNUSED(level);
+	return false;
+}
+#endif /* CONFIG_NRF_CLOUD_LOG_RATE_LIMIT */
+
 static void logger_process(const struct log_backend *const backend, union log_msg_generic *msg)
 {
 	log_format_func_t log_output_func;
@@ -237,6 +322,12 @@ static void logger_process(const struct log_backend *const backend, union log_ms
 		return;
 	}
 
+	/* Discard the message before it is formatted so it costs neither CPU time nor airtime */
+	if (log_msg_rate_limited(src_id, level)) {
+		stats.lines_rate_limited++;
+		return;
+	}
+
 	const char *src_name =
 		src_id != UNKNOWN_LOG_SOURCE ? log_source_name_get(dom_id, src_id) : NULL;
 	int64_t ts = log_output_timestamp_to_us(log_msg_get_timestamp(&msg->log)) / 1000U;
@@ -288,6 +379,35 @@ static int logger_format_set(const struct log_backend *const backend, uint32_t l
 	return -ENOTSUP;
 }
 
+/** Returns the time in ms until the pending batch is due to be sent, or 0 if it is due now. */
+static int64_t log_batch_due_in(void)
+{
+	if ((CONFIG_NRF_CLOUD_LOG_BATCH_INTERVAL_MS == 0) || batch_urgent) {
+		return 0;
+	}
+	return MAX(CONFIG_NRF_CLOUD_LOG_BATCH_INTERVAL_MS - (k_uptime_get() - last_send_time), 0);
+}
+
+/* Sends the pending batch when the batch interval expires without further log messages */
+static void log_batch_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if ((num_msgs == 0) || (logger_is_ready(&log_nrf_cloud_backend) != 0)) {
+		return;
+	}
+
+	/* The logging thread is storing a message, so try again shortly */
+	if (k_sem_take(&ncl_active, K_NO_WAIT) < 0) {
+		k_work_schedule_for_queue(&log_batch_workq, &log_batch_work,
+					  K_MSEC(LOG_OUTPUT_RETRY_DELAY_MS));
+		return;
+	}
+
+	send_ring_buffer();
+	k_sem_give(&ncl_active);
+}
+
 static void logger_notify(const struct log_backend *const backend, enum log_backend_evt event,
 			  union log_backend_evt_arg *arg)
 {
@@ -296,14 +416,30 @@ static void logger_notify(const struct log_backend *const backend, enum log_back
 		return;
 	}
 
-	/* Flush our transmission buffer */
+	/* Keep collecting messages into the current batch until the batch interval expires,
+	 * unless an error message is waiting. The batch is also sent when the buffer fills up,
+	 * or by the batch work if no more messages are logged before the interval expires.
+	 */
+	int64_t due_in = log_batch_due_in();
+
+	if (due_in > 0) {
+		if (num_msgs != 0) {
+			k_work_schedule_for_queue(&log_batch_workq, &log_batch_work,
+						  K_MSEC(due_in));
+		}
+		return;
+	}
+
+	/* Flush our transmission buffer, unless the batch work is doing it */
+	k_sem_take(&ncl_active, K_FOREVER);
 	send_ring_buffer();
+	k_sem_give(&ncl_active);
 	if (CONFIG_NRF_CLOUD_LOG_LOG_LEVEL >= LOG_LEVEL_DBG) {
 		LOG_DBG("Buffered lines:%u, bytes:%u; logged lines:%u, bytes:%u; "
-			"sent lines:%u, bytes:%u; dropped lines:%u",
+			"sent lines:%u, bytes:%u; dropped lines:%u, rate limited lines:%u",
 			log_buffered_cnt(), ring_buf_size_get(&log_nrf_cloud_rb),
 			stats.lines_rendered, stats.bytes_rendered, stats.lines_sent,
-			stats.bytes_sent, stats.lines_dropped);
+			stats.bytes_sent, stats.lines_dropped, stats.lines_rate_limited);
 	} else {
 		LOG_INF("Sent lines:%u, bytes:%u", stats.lines_sent, stats.bytes_sent);
 	}
@@ -374,6 +510,11 @@ cleanup:
 	ret = ring_buf_get_finish(&log_nrf_cloud_rb, stored);
 	ring_buf_reset(&log_nrf_cloud_rb);
 	num_msgs = 0;
+	batch_urgent = false;
+	last_send_time = k_uptime_get();
+	if (CONFIG_NRF_CLOUD_LOG_BATCH_INTERVAL_MS != 0) {
+		k_work_cancel_delayable(&log_batch_work);
+	}
 
 	if (ret) {
 		LOG_ERR("Error finishing ring buffer: %d", ret);
@@ -397,7 +538,9 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 		return 0;
 	}
 
-	if (k_sem_take(&ncl_active, K_NO_WAIT) < 0) {
+	/* Wait for a batch being sent by the batch work instead of dropping the message */
+	if (k_sem_take(&ncl_active, (k_work_delayable_busy_get(&log_batch_work) & K_WORK_RUNNING) ?
+					    K_FOREVER : K_NO_WAIT) < 0) {
 		return orig_size;
 	}
 
@@ -473,6 +616,9 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 				LOG_WRN("Stored:%u, put:%u", stored, data.len);
 			}
 			num_msgs++;
+			if (log_context.level == LOG_LEVEL_ERR) {
+				batch_urgent = true;
+			}
 			if (log_format_current == LOG_OUTPUT_TEXT) {
 				cJSON_free((void *)data.ptr);
 			}
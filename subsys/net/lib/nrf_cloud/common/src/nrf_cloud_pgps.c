@@ -76,15 +76,26 @@ struct pgps_index {
 	int32_t storage_extent;
 	int store_block;
 
-	/* Array of memory offsets to predictions, in sorted time order.
-	 * If flash device is external, this must be passed
-	 * to read_prediction() to read a copy to a local buffer.
+	/* Directory of memory offsets to predictions, in sorted time order.
+	 * It is a ring starting at 'first', so prediction number pnum, which is
+	 * relative to start_sec, is found at (first + pnum) % NUM_PREDICTIONS.
+	 * Discarding the oldest predictions only advances 'first'.
+	 * If flash device is external, the offset must be passed
+	 * to get_cached_prediction() to read a copy to a local buffer.
 	 * If flash device is internal, it can be converted directly to
 	 * a pointer.
+	 * Use the prediction_entry_*() functions to access it.
 	 */
 	struct nrf_cloud_pgps_prediction *predictions[NUM_PREDICTIONS];
+	uint8_t first;
+	/* Bitmask of directory positions whose prediction has passed full
+	 * validation since it was stored; only new predictions are validated.
+	 */
+	uint64_t validated;
 };
 
+BUILD_ASSERT(NUM_PREDICTIONS <= 64, "Validation bitmask is too small");
+
 static struct pgps_index index;
 
 static struct stream_flash_ctx stream;
@@ -117,6 +128,8 @@ static void prediction_work_handler(struct k_work *work);
 static void prediction_timer_handler(struct k_timer *dummy);
 void agnss_print_enable(bool enable);
 static void print_time_details(const char *info, int64_t sec, uint16_t day, uint32_t time_of_day);
+static void get_prediction_day_time(int pnum, int64_t *gps_sec, uint16_t *gps_day,
+				    uint32_t *gps_time_of_day);
 
 K_WORK_DEFINE(prediction_work, prediction_work_handler);
 K_TIMER_DEFINE(prediction_timer, prediction_timer_handler, NULL);
@@ -128,9 +141,44 @@ static void discard_prediction_buffer(void)
 #endif
 }
 
+static int prediction_entry_pos(int pnum)
+{
+	return (index.first + pnum) % NUM_PREDICTIONS;
+}
+
+static struct nrf_cloud_pgps_prediction *prediction_entry_get(int pnum)
+{
+	return index.predictions[prediction_entry_pos(pnum)];
+}
+
+static void prediction_entry_set(int pnum, struct nrf_cloud_pgps_prediction *p)
+{
+	int pos = prediction_entry_pos(pnum);
+
+	index.predictions[pos] = p;
+	index.validated &= ~BIT64(pos);
+}
+
+static bool prediction_entry_validated(int pnum)
+{
+	return (index.validated & BIT64(prediction_entry_pos(pnum))) != 0;
+}
+
+static void prediction_entry_validated_set(int pnum)
+{
+	index.validated |= BIT64(prediction_entry_pos(pnum));
+}
+
+static void prediction_entries_reset(void)
+{
+	memset(index.predictions, 0, sizeof(index.predictions));
+	index.first = 0;
+	index.validated = 0;
+}
+
 static int get_prediction_block(int pnum)
 {
-	return npgps_pointer_to_block((uint8_t *)index.predictions[pnum]);
+	return npgps_pointer_to_block((uint8_t *)prediction_entry_get(pnum));
 }
 
 /**
@@ -174,7 +222,7 @@ static struct nrf_cloud_pgps_prediction *get_cached_prediction(off_t off)
 
 static struct nrf_cloud_pgps_prediction *get_prediction(int pnum)
 {
-	off_t off = (off_t)index.predictions[pnum];
+	off_t off = (off_t)prediction_entry_get(pnum);
 
 	return get_cached_prediction(off);
 }
@@ -190,13 +238,37 @@ static struct nrf_cloud_pgps_prediction *get_prediction_slot(int slot, off_t *fl
 	return get_cached_prediction(off);
 }
 
+/**
+ * @brief Read only the time of the prediction in the given storage slot. When using external
+ * flash, this avoids reading the whole prediction into the prediction cache.
+ */
+static int get_prediction_slot_time(int slot, struct nrf_cloud_pgps_system_time *time)
+{
+	off_t off = storage_addr + slot * PGPS_PREDICTION_STORAGE_SIZE;
+
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+	int err;
+
+	off += offsetof(struct nrf_cloud_pgps_prediction, time);
+	err = flash_area_read(prediction_flash_area, off - prediction_flash_area->fa_off,
+			      time, sizeof(*time));
+	if (err) {
+		LOG_ERR("Error %d reading prediction time from flash offset 0x%lx", err, off);
+		return err;
+	}
+#else
+	memcpy(time, &((struct nrf_cloud_pgps_prediction *)off)->time, sizeof(*time));
+#endif
+	return 0;
+}
+
 static int determine_prediction_num(struct nrf_cloud_pgps_header *header,
-				    struct nrf_cloud_pgps_prediction *p)
+				    const struct nrf_cloud_pgps_system_time *time)
 {
 	int64_t start_sec = npgps_gps_day_time_to_sec(header->gps_day, header->gps_time_of_day);
 	uint32_t period_sec = header->prediction_period_min * SEC_PER_MIN;
 	int64_t end_sec = start_sec + header->prediction_count * period_sec;
-	int64_t pred_sec = npgps_gps_day_time_to_sec(p->time.date_day, p->time.time_full_s);
+	int64_t pred_sec = npgps_gps_day_time_to_sec(time->date_day, time->time_full_s);
 
 	if ((start_sec <= pred_sec) && (pred_sec < end_sec)) {
 		return (int)((pred_sec - start_sec) / period_sec);
@@ -291,6 +363,46 @@ static int validate_prediction(const struct nrf_cloud_pgps_prediction *p, uint16
 	return 0;
 }
 
+/* Fully validate a prediction stored since the last validation */
+static int validate_new_prediction(int pnum, const struct nrf_cloud_pgps_prediction *p)
+{
+	uint16_t gps_day;
+	uint32_t gps_time_of_day;
+	int err;
+
+	get_prediction_day_time(pnum, NULL, &gps_day, &gps_time_of_day);
+
+	err = validate_prediction(p, gps_day, gps_time_of_day, index.header.prediction_period_min,
+				  true, false);
+	if (!err) {
+		prediction_entry_validated_set(pnum);
+	}
+
+	return err;
+}
+
+static int validate_prediction_time(int pnum, int64_t gps_sec, bool margin)
+{
+	int64_t pred_sec;
+	int64_t end_sec;
+
+	get_prediction_day_time(pnum, &pred_sec, NULL, NULL);
+	end_sec = pred_sec + index.period_sec;
+
+	if (margin) {
+		end_sec += PGPS_MARGIN_SEC;
+	}
+
+	if ((gps_sec < pred_sec) || (gps_sec > end_sec)) {
+		LOG_ERR("prediction does not contain desired time; "
+			"start:%d, cur:%d, end:%d",
+			(int32_t)pred_sec, (int32_t)gps_sec, (int32_t)end_sec);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 static int validate_stored_predictions(uint16_t *first_bad_day, uint32_t *first_bad_time)
 {
 	int err;
@@ -301,33 +413,32 @@ static int validate_stored_predictions(uint16_t *first_bad_day, uint32_t *first_
 	uint16_t gps_day = index.header.gps_day;
 	uint32_t gps_time_of_day = index.header.gps_time_of_day;
 	struct nrf_cloud_pgps_prediction *pred;
+	struct nrf_cloud_pgps_system_time pred_time;
 	int64_t start_gps_sec = index.start_sec;
 	off_t off;
 	int64_t gps_sec;
 
 	/* reset catalog of predictions */
 	discard_prediction_buffer();
-	for (pnum = 0; pnum < count; pnum++) {
-		index.predictions[pnum] = NULL;
-	}
+	prediction_entries_reset();
 
 	npgps_reset_block_pool();
 
-	/* build catalog of predictions by block */
+	/* build catalog of predictions by block, reading only their times */
 	for (i = 0; i < count; i++) {
-		pred = (struct nrf_cloud_pgps_prediction *)get_prediction_slot(i, &off);
-		if (pred == NULL) {
+		off = storage_addr + i * PGPS_PREDICTION_STORAGE_SIZE;
+		if (get_prediction_slot_time(i, &pred_time)) {
 			LOG_ERR("Prediction at idx:%d not accessible", i);
 			continue;
 		}
 
-		pnum = determine_prediction_num(&index.header, pred);
+		pnum = determine_prediction_num(&index.header, &pred_time);
 		if (pnum < 0) {
-			LOG_ERR("prediction idx:%u, ofs:%p, out of expected time range;"
+			LOG_ERR("prediction idx:%u, ofs:0x%lX, out of expected time range;"
 				" day:%u, time:%u",
-				i, (void *)pred, pred->time.date_day, pred->time.time_full_s);
-		} else if (index.predictions[pnum] == NULL) {
-			index.predictions[pnum] = (struct nrf_cloud_pgps_prediction *)off;
+				i, (unsigned long)off, pred_time.date_day, pred_time.time_full_s);
+		} else if (prediction_entry_get(pnum) == NULL) {
+			prediction_entry_set(pnum, (struct nrf_cloud_pgps_prediction *)off);
 			LOG_DBG("Prediction num:%u stored at idx:%d, off:0x%lX", pnum, i,
 				(unsigned long)off);
 		} else {
@@ -362,6 +473,7 @@ static int validate_stored_predictions(uint16_t *first_bad_day, uint32_t *first_
 			break;
 		}
 
+		prediction_entry_validated_set(pnum);
 		i = get_prediction_block(pnum);
 		LOG_DBG("Prediction num:%u, loc:%p, blk:%d", pnum, pred, i);
 		__ASSERT(i != NO_BLOCK, "unexpected pointer value %p", pred);
@@ -418,22 +530,21 @@ static void discard_oldest_predictions(int num)
 	for (pnum = 0; pnum < last; pnum++) {
 		block = get_prediction_block(pnum);
 		__ASSERT((block != -1), "unexpected ptr:%p for Prediction num:%d",
-			 index.predictions[pnum], pnum);
+			 prediction_entry_get(pnum), pnum);
 		npgps_free_block(block);
+		prediction_entry_set(pnum, NULL);
 	}
 
-	/* move predictions we are keeping to the start */
-	for (i = last; i < index.header.prediction_count; i++) {
-		pnum = i - last;
-		index.predictions[pnum] = index.predictions[i];
-	}
+	/* the predictions we are keeping start at 'last'; advance the
+	 * start of the directory instead of moving the entries
+	 */
+	index.first = prediction_entry_pos(last);
 
 	/* set prediction pointers for 'last' in the newly empty
 	 * entries to NULL
 	 */
-	for (pnum = index.header.prediction_count - last; pnum < index.header.prediction_count;
-	     pnum++) {
-		index.predictions[pnum] = NULL;
+	for (i = index.header.prediction_count - last; i < index.header.prediction_count; i++) {
+		prediction_entry_set(i, NULL);
 	}
 	npgps_print_blocks();
 
@@ -460,6 +571,7 @@ int nrf_cloud_pgps_notify_prediction(void)
 	 */
 	int err;
 	int pnum;
+	uint32_t start_cycles;
 	struct nrf_cloud_pgps_prediction *prediction = NULL;
 	struct nrf_cloud_pgps_event evt = {
 		.type = PGPS_EVT_AVAILABLE,
@@ -474,7 +586,10 @@ int nrf_cloud_pgps_notify_prediction(void)
 		REPLACEMENT_THRESHOLD);
 
 	LOG_INF("Searching for prediction");
+	start_cycles = k_cycle_get_32();
 	err = nrf_cloud_pgps_find_prediction(&prediction);
+	LOG_DBG("Prediction search took %u us",
+		k_cyc_to_us_floor32(k_cycle_get_32() - start_cycles));
 	if (err == -ELOADING) {
 		loading_in_progress = true;
 		notified = false;
@@ -510,6 +625,7 @@ int nrf_cloud_pgps_notify_prediction(void)
 static void prediction_work_handler(struct k_work *work)
 {
 	struct nrf_cloud_pgps_prediction *p = NULL;
+	uint32_t start_cycles = k_cycle_get_32();
 	int ret;
 
 	LOG_DBG("Prediction is expiring; finding next");
@@ -520,7 +636,8 @@ static void prediction_work_handler(struct k_work *work)
 		if (ret) {
 			LOG_ERR("Error injecting prediction:%d", ret);
 		} else {
-			LOG_DBG("Next prediction injected successfully.");
+			LOG_DBG("Next prediction injected successfully in %u us.",
+				k_cyc_to_us_floor32(k_cycle_get_32() - start_cycles));
 		}
 	}
 }
@@ -661,8 +778,19 @@ int nrf_cloud_pgps_find_prediction(struct nrf_cloud_pgps_prediction **prediction
 	index.cur_pnum = pnum;
 	*prediction = get_prediction(pnum);
 	if (*prediction) {
-		err = validate_prediction(*prediction, cur_gps_day, cur_gps_time_of_day, period_min,
-					  false, margin);
+		if (prediction_entry_validated(pnum)) {
+			/* Contents were fully checked already; only the time range
+			 * needs to be checked, which the directory knows.
+			 */
+			err = validate_prediction_time(pnum, cur_gps_sec, margin);
+		} else {
+			err = validate_new_prediction(pnum, *prediction);
+			if (!err) {
+				err = validate_prediction(*prediction, cur_gps_day,
+							  cur_gps_time_of_day, period_min,
+							  false, margin);
+			}
+		}
 		if (!err) {
 			start_expiration_timer(pnum, cur_gps_sec);
 			return pnum;
@@ -1440,7 +1568,7 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 	if (parsed_len == buf_len) {
 		LOG_DBG("Parsing finished");
 
-		if (index.predictions[pnum]) {
+		if (prediction_entry_get(pnum)) {
 			LOG_WRN("Received duplicate packet; ignoring");
 		} else if (gps_sec == 0) {
 			LOG_ERR("Prediction did not include GPS day and time of day; ignoring");
@@ -1457,7 +1585,7 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 				LOG_ERR("Error storing prediction:%d", err);
 				goto fail;
 			}
-			index.predictions[pnum] = npgps_block_to_pointer(index.store_block);
+			prediction_entry_set(pnum, npgps_block_to_pointer(index.store_block));
 
 			if (!finished) {
 				if (loading_in_progress && !notified && (index.loading_count > 1)) {
@@ -1558,11 +1686,11 @@ int nrf_cloud_pgps_begin_update(void)
 		index.header.prediction_count = NUM_PREDICTIONS;
 		index.header.prediction_period_min = PREDICTION_PERIOD;
 		index.period_sec = index.header.prediction_period_min * SEC_PER_MIN;
-		memset(index.predictions, 0, sizeof(index.predictions));
+		prediction_entries_reset();
 	} else {
 		for (uint8_t pnum = index.pnum_offset;
 		     pnum < index.expected_count + index.pnum_offset; pnum++) {
-			index.predictions[pnum] = NULL;
+			prediction_entry_set(pnum, NULL);
 		}
 	}
 
@@ -14,6 +14,46 @@
 #include "nrf_cloud_codec_internal.h"
 #include "nrf_cloud_transport.h"
 
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(nrf_cloud_location_mqtt, CONFIG_NRF_CLOUD_LOG_LEVEL);
+
+#if defined(CONFIG_NRF_CLOUD_LOCATION_STREAM_ENCODE)
+static K_MUTEX_DEFINE(req_buf_mutex);
+static char req_buf[CONFIG_NRF_CLOUD_LOCATION_STREAM_ENCODE_BUF_SIZE];
+
+static int location_request_stream_send(const struct lte_lc_cells_info *const cells_inf,
+					const struct wifi_scan_info *const wifi_inf,
+					const struct nrf_cloud_location_config *const config,
+					nrf_cloud_location_response_t cb)
+{
+	size_t len = sizeof(req_buf);
+	int err;
+
+	k_mutex_lock(&req_buf_mutex, K_FOREVER);
+	err = nrf_cloud_location_req_json_buf_encode(cells_inf, wifi_inf, config, 0,
+						     req_buf, &len);
+	if (!err) {
+		struct nct_dc_data msg = {.data.ptr = req_buf, .data.len = len};
+
+		if (!config || (config->do_reply)) {
+			nfsm_set_location_response_cb(cb);
+		}
+
+		LOG_DBG("Created request: %s (size: %zu)", req_buf, len);
+		err = nct_dc_send(&msg);
+		if (err) {
+			LOG_ERR("Failed to send request, error: %d", err);
+		}
+	} else if (err == -ENOMEM) {
+		/* Let the caller fall back to cJSON; not to be mixed up with a send failure */
+		err = -E2BIG;
+	}
+	k_mutex_unlock(&req_buf_mutex);
+
+	return err;
+}
+#endif /* CONFIG_NRF_CLOUD_LOCATION_STREAM_ENCODE */
+
 int nrf_cloud_location_request(const struct lte_lc_cells_info *const cells_inf,
 			       const struct wifi_scan_info *const wifi_inf,
 			       const struct nrf_cloud_location_config *const config,
@@ -25,6 +65,14 @@ int nrf_cloud_location_request(const struct lte_lc_cells_info *const cells_inf,
 
 	int err = 0;
 
+#if defined(CONFIG_NRF_CLOUD_LOCATION_STREAM_ENCODE)
+	err = location_request_stream_send(cells_inf, wifi_inf, config, cb);
+	if (err != -E2BIG) {
+		return err;
+	}
+	LOG_DBG("Location request does not fit in buffer, using cJSON");
+#endif
+
 	NRF_CLOUD_OBJ_JSON_DEFINE(location_req_obj);
 
 	err = nrf_cloud_obj_location_request_create(&location_req_obj, cells_inf, wifi_inf, config);
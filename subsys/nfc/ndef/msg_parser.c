@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <errno.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include "msg_parser_local.h"
@@ -30,6 +31,92 @@ int nfc_ndef_msg_parse(uint8_t *result_buf, uint32_t *result_buf_len, const uint
 	return err;
 }
 
+void nfc_ndef_msg_iter_init(struct nfc_ndef_msg_iter *iter, const uint8_t *raw_data,
+			    uint32_t raw_data_len)
+{
+	__ASSERT_NO_MSG(iter);
+
+	iter->data = raw_data;
+	iter->data_len = raw_data_len;
+	iter->record_count = 0;
+	iter->end = false;
+}
+
+int nfc_ndef_msg_iter_next(struct nfc_ndef_msg_iter *iter,
+			   struct nfc_ndef_record_desc *rec_desc,
+			   struct nfc_ndef_bin_payload_desc *bin_pay_desc)
+{
+	enum nfc_ndef_record_location record_location;
+	uint32_t record_len;
+	int err;
+
+	if (!iter || !rec_desc || !bin_pay_desc) {
+		return -EINVAL;
+	}
+
+	if (iter->end) {
+		return -ENOENT;
+	}
+
+	/* The data ended before the last record. */
+	if (!iter->data || (iter->data_len == 0)) {
+		return -EFAULT;
+	}
+
+	record_len = iter->data_len;
+
+	err = nfc_ndef_record_parse(bin_pay_desc, rec_desc, &record_location, iter->data,
+				    &record_len);
+	if (err) {
+		return err;
+	}
+
+	/* Verify the records location flags. */
+	if (iter->record_count == 0) {
+		if ((record_location != NDEF_FIRST_RECORD) &&
+		    (record_location != NDEF_LONE_RECORD)) {
+			return -EFAULT;
+		}
+	} else {
+		if ((record_location != NDEF_MIDDLE_RECORD) &&
+		    (record_location != NDEF_LAST_RECORD)) {
+			return -EFAULT;
+		}
+	}
+
+	iter->data += record_len;
+	iter->data_len -= record_len;
+	iter->record_count++;
+	iter->end = (record_location == NDEF_LAST_RECORD) ||
+		    (record_location == NDEF_LONE_RECORD);
+
+	return 0;
+}
+
+int nfc_ndef_msg_record_find(const uint8_t *raw_data, uint32_t raw_data_len,
+			     nfc_ndef_record_match_t match,
+			     struct nfc_ndef_record_desc *rec_desc,
+			     struct nfc_ndef_bin_payload_desc *bin_pay_desc)
+{
+	struct nfc_ndef_msg_iter iter;
+	int err;
+
+	if (!match) {
+		return -EINVAL;
+	}
+
+	nfc_ndef_msg_iter_init(&iter, raw_data, raw_data_len);
+
+	do {
+		err = nfc_ndef_msg_iter_next(&iter, rec_desc, bin_pay_desc);
+		if (err) {
+			return err;
+		}
+	} while (!match(rec_desc));
+
+	return 0;
+}
+
 void nfc_ndef_msg_printout(const struct nfc_ndef_msg_desc *msg_desc)
 {
 	uint32_t i;
@@ -75,6 +75,11 @@ int nfc_ndef_record_parse(struct nfc_ndef_bin_payload_desc *bin_pay_desc,
 		rec_desc->id = NULL;
 	}
 
+	/* Check the payload length separately so that the sum below cannot overflow. */
+	if (payload_length > *nfc_data_len) {
+		return -EINVAL;
+	}
+
 	expected_rec_size += rec_desc->type_length + rec_desc->id_length + payload_length;
 
 	if (expected_rec_size > *nfc_data_len) {
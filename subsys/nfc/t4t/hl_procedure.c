@@ -24,8 +24,9 @@ LOG_MODULE_REGISTER(nfc_t4t_hl_procedure,
 #define CC_MIN_RAPDU_SIZE 0x0F
 #define CC_RAPDU_MAX_SIZE_OFFSET 0x03
 #define NFC_T4T_APDU_SELECT_DATA {0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01}
-#define APDU_LE_MAP_2_MAX_VALUE 0xFF
 #define NFC_T4T_APDU_RSP_ALL 256
+/* Header (CLA, INS, P1, P2) and extended-length Lc field of the C-APDU. */
+#define CAPDU_UPDATE_OVERHEAD 7
 
 enum nfc_t4t_hl_transaction_type {
 	NFC_T4T_HL_SELECT,
@@ -79,6 +80,23 @@ static int t4t_hl_data_exchange(struct nfc_t4t_apdu_comm *comm)
 	return nfc_t4t_isodep_transmit(t4t_hl.apdu_buff, apdu_len);
 }
 
+/* Largest chunk read with one READ BINARY command. Responses longer than 255 bytes use
+ * extended-length APDUs, which the tag supports if it sets MLe above 255 in the CC file.
+ */
+static uint16_t ndef_read_chunk_max(void)
+{
+	return MIN(t4t_hl.ndef.cc->max_rapdu_size, CONFIG_NFC_T4T_HL_PROCEDURE_MAX_RAPDU_SIZE);
+}
+
+/* Largest chunk written with one UPDATE BINARY command, limited by MLc from the CC file
+ * and the space left in the APDU buffer.
+ */
+static uint16_t ndef_update_chunk_max(void)
+{
+	return MIN(t4t_hl.ndef.cc->max_capdu_size,
+		   sizeof(t4t_hl.apdu_buff) - CAPDU_UPDATE_OVERHEAD);
+}
+
 static int on_cc_read(const struct nfc_t4t_apdu_resp *resp)
 {
 	__ASSERT_NO_MSG(resp);
@@ -180,7 +198,7 @@ static int ndef_file_chunk_read(const struct nfc_t4t_apdu_resp *resp)
 		apdu_comm.instruction = NFC_T4T_APDU_COMM_INS_READ;
 		apdu_comm.parameter = t4t_hl.file_offset;
 		apdu_comm.resp_len = MIN(t4t_hl.ndef.nlen - (t4t_hl.file_offset - NDEF_FILE_NLEN_SIZE),
-				MIN(APDU_LE_MAP_2_MAX_VALUE, t4t_hl.ndef.cc->max_rapdu_size));
+				ndef_read_chunk_max());
 
 		t4t_hl.transaction_type = NFC_T4T_HL_NDEF_READ;
 
@@ -215,7 +233,7 @@ static int ndef_file_chunk_update(void)
 		apdu_comm.parameter = t4t_hl.file_offset;
 		apdu_comm.data.buff = t4t_hl.ndef.buff + t4t_hl.file_offset;
 		apdu_comm.data.len = MIN(t4t_hl.ndef.buff_size - t4t_hl.file_offset,
-				MIN(APDU_LE_MAP_2_MAX_VALUE, t4t_hl.ndef.cc->max_capdu_size));
+				ndef_update_chunk_max());
 
 		t4t_hl.file_offset += apdu_comm.data.len;
 		t4t_hl.transaction_type = NFC_T4T_HL_NDEF_UPDATE;
@@ -116,7 +116,12 @@ struct nfc_t4t_err {
 struct nfc_t4t_isodep {
 	atomic_t state;
 	struct nfc_t4t_isodep_tag tag;
+	uint8_t *tx_buf;
 	struct nfc_t4t_buf tx_data;
+	/* Next chained I-block, prepared while the current one is in flight. */
+	struct nfc_t4t_buf tx_next;
+	size_t next_data_len;
+	bool next_chaining;
 	struct nfc_t4t_buf rx_data;
 	struct nfc_t4t_err err_status;
 	uint16_t fsd;
@@ -145,6 +150,7 @@ static void isodep_transmission_clear(void)
 	t4t_isodep.transmitted_len            = 0;
 	t4t_isodep.transmit_len               = 0;
 	t4t_isodep.chaining                   = false;
+	t4t_isodep.tx_next.len                = 0;
 	t4t_isodep.retransmit_cnt             = 0;
 	t4t_isodep.err_status.frame_retry_cnt = 0;
 	t4t_isodep.err_status.last_frame      = ISODEP_FRAME_NONE;
@@ -211,6 +217,18 @@ static int ats_parse(const uint8_t *data, size_t len)
 	/* Include space for CRC */
 	t4t_isodep.tag.fsc -= ISODEP_CRC_LENGTH;
 
+	/* If the Tx buffer can hold two frames, the next chained I-block
+	 * is prepared in the other half while the current one is sent.
+	 */
+	t4t_isodep.tx_data.data = t4t_isodep.tx_buf;
+	t4t_isodep.tx_next.len = 0;
+
+	if (t4t_isodep.tx_data.buf_size >= (2 * t4t_isodep.tag.fsc)) {
+		t4t_isodep.tx_next.data = t4t_isodep.tx_buf + t4t_isodep.tag.fsc;
+	} else {
+		t4t_isodep.tx_next.data = NULL;
+	}
+
 	/* Check id ATS contains interface bytes, if not
 	 * set all data to default values according to
 	 * NFC Forum Digital Specification 2.0 14.6.2.
@@ -292,17 +310,44 @@ static int ats_parse(const uint8_t *data, size_t len)
 	return 0;
 }
 
-static void isodep_chunk_send(void)
+/* Prepare an I-block with the data starting at the given offset. The block
+ * number is set when the block is sent.
+ */
+static size_t isodep_i_block_prepare(uint8_t *tx_data, size_t offset,
+				     size_t *data_len, bool *chaining)
 {
-	size_t data_len;
-	uint32_t fdt;
 	size_t index = 0;
 	const uint8_t *data = t4t_isodep.transmit_data;
-	uint8_t *tx_data = t4t_isodep.tx_data.data;
 
 	__ASSERT_NO_MSG(data);
 	__ASSERT_NO_MSG(tx_data);
 
+	tx_data[index] = ISODEP_I_BLOCK;
+
+	/* Check if DID field should be included. */
+	index = did_include(tx_data, index);
+
+	/* Use chaining when data is to long. */
+	if ((t4t_isodep.tag.fsc - index) < (t4t_isodep.transmit_len - offset)) {
+		tx_data[0] |= I_BLOCK_CHAINING_BIT;
+		*data_len = t4t_isodep.tag.fsc - index;
+		*chaining = true;
+	} else {
+		*data_len = t4t_isodep.transmit_len - offset;
+		*chaining = false;
+	}
+
+	memcpy(&tx_data[index], &data[offset], *data_len);
+
+	return index + *data_len;
+}
+
+static void isodep_chunk_send(void)
+{
+	size_t data_len;
+	uint32_t fdt;
+	uint8_t *tx_data;
+
 	/* New block, clear retransmission and error counters. */
 	t4t_isodep.retransmit_cnt = 0;
 	t4t_isodep.err_status.frame_retry_cnt = 0;
@@ -312,28 +357,25 @@ static void isodep_chunk_send(void)
 	 */
 	t4t_isodep.err_status.last_frame = ISODEP_FRAME_I;
 
-	/* Prepare first chunk. */
-	tx_data[index] = ISODEP_I_BLOCK | (t4t_isodep.block_num & 1);
+	if (t4t_isodep.tx_next.len > 0) {
+		/* Use the block prepared while the previous one was in flight. */
+		tx_data = t4t_isodep.tx_next.data;
+		t4t_isodep.tx_next.data = t4t_isodep.tx_data.data;
+		t4t_isodep.tx_data.data = tx_data;
+		t4t_isodep.tx_data.len = t4t_isodep.tx_next.len;
+		t4t_isodep.tx_next.len = 0;
 
-	/* Check if DID field should be included. */
-	index = did_include(tx_data, index);
-
-	/* Use chaining when data is to long. */
-	if ((t4t_isodep.tag.fsc - index) <
-	    (t4t_isodep.transmit_len - t4t_isodep.transmitted_len)) {
-		tx_data[0] |= I_BLOCK_CHAINING_BIT;
-		data_len = t4t_isodep.tag.fsc - index;
-		t4t_isodep.chaining = true;
+		data_len = t4t_isodep.next_data_len;
+		t4t_isodep.chaining = t4t_isodep.next_chaining;
 	} else {
-		data_len = t4t_isodep.transmit_len - t4t_isodep.transmitted_len;
-		t4t_isodep.chaining = false;
+		t4t_isodep.tx_data.len = isodep_i_block_prepare(t4t_isodep.tx_data.data,
+								t4t_isodep.transmitted_len,
+								&data_len,
+								&t4t_isodep.chaining);
 	}
 
-	memcpy(&tx_data[index], &data[t4t_isodep.transmitted_len], data_len);
-
-	index += data_len;
-	t4t_isodep.tx_data.len = index;
 	t4t_isodep.transmitted_len += data_len;
+	t4t_isodep.tx_data.data[0] |= (t4t_isodep.block_num & 1);
 
 	fdt = t4t_isodep.tag.fwt + T4T_FWT_DELTA + NFCA_T4T_FWT_T_FC;
 
@@ -341,6 +383,16 @@ static void isodep_chunk_send(void)
 		t4t_isodep_cb->ready_to_send(t4t_isodep.tx_data.data,
 					     t4t_isodep.tx_data.len, fdt);
 	}
+
+	/* Prepare the next chained block, so that it can be sent as soon as
+	 * the R(ACK) for the current one is received.
+	 */
+	if (t4t_isodep.chaining && t4t_isodep.tx_next.data) {
+		t4t_isodep.tx_next.len = isodep_i_block_prepare(t4t_isodep.tx_next.data,
+								t4t_isodep.transmitted_len,
+								&t4t_isodep.next_data_len,
+								&t4t_isodep.next_chaining);
+	}
 }
 
 static void block_num_toggle(void)
@@ -723,6 +775,7 @@ int nfc_t4t_isodep_init(uint8_t *tx_buf, size_t size_tx,
 		return -EACCES;
 	}
 
+	t4t_isodep.tx_buf = tx_buf;
 	t4t_isodep.tx_data.data = tx_buf;
 	t4t_isodep.tx_data.buf_size = size_tx;
 	t4t_isodep.rx_data.data = rx_buf;
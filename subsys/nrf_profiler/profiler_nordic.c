@@ -8,11 +8,13 @@
 #include <zephyr/kernel_structs.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/kernel.h>
-#include <SEGGER_RTT.h>
 #include <nrf_profiler.h>
 #include <string.h>
-#include <nrfx.h>
+
+#include "profiler_nordic_transport.h"
+
 
 
 enum state {
@@ -28,7 +30,40 @@ struct nrf_profiler_event_enabled_bm _nrf_profiler_event_enabled_bm;
 static K_SEM_DEFINE(nrf_profiler_sem, 0, 1);
 static atomic_t nrf_profiler_state;
 static uint16_t fatal_error_event_id;
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_STAGING
+#define STAGING_SIZE	CONFIG_NRF_PROFILER_NORDIC_STAGING_BUFFER_SIZE
+/* Records are aligned so that the record header can be accessed atomically. */
+#define STAGING_ALIGN	sizeof(atomic_t)
+#define STAGING_HDR_LEN_MASK	BIT_MASK(16)
+#define STAGING_HDR_PADDING	BIT(16)
+#define STAGING_HDR_COMMITTED	BIT(17)
+
+BUILD_ASSERT(STAGING_SIZE <= STAGING_HDR_LEN_MASK,
+	     "Staging buffer too big for the record length field");
+BUILD_ASSERT(IS_POWER_OF_TWO(STAGING_SIZE),
+	     "Staging buffer size must be a power of two");
+BUILD_ASSERT(STAGING_ALIGN + ROUND_UP(CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN, STAGING_ALIGN)
+	     <= STAGING_SIZE / 2, "Staging buffer too small for the custom event buffer");
+
+/* Staging ring written by the producers running on one CPU and read by the
+ * nrf_profiler thread. A producer reserves space by advancing the head with
+ * a compare-and-swap, copies the event and then commits it by writing the
+ * record header. Free space is kept zeroed, so that a record that is reserved
+ * but not yet committed has no COMMITTED flag in its header.
+ */
+struct staging_ring {
+	atomic_t head;
+	atomic_t tail;
+	uint8_t buf[STAGING_SIZE] __aligned(STAGING_ALIGN);
+};
+
+static struct staging_ring staging_rings[CONFIG_MP_MAX_NUM_CPUS];
+static atomic_t staging_dropped;
+static uint16_t drop_event_id;
+#else
 static struct k_spinlock lock;
+#endif /* CONFIG_NRF_PROFILER_NORDIC_STAGING */
 
 enum nordic_command {
 	NORDIC_COMMAND_START	= 1,
@@ -51,9 +86,8 @@ static char *arg_types_encodings[] = {
 
 uint8_t nrf_profiler_num_events;
 
-static uint8_t buffer_data[CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE];
-static uint8_t buffer_info[CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE];
-static uint8_t buffer_commands[CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE];
+static const struct nrf_profiler_nordic_transport *const transport =
+	&nrf_profiler_nordic_transport;
 
 static k_tid_t protocol_thread_id;
 
@@ -66,22 +100,13 @@ static int send_info_data(const char *data, size_t data_len)
 	uint8_t retry_cnt = 0;
 	static const uint8_t retry_cnt_max = 100;
 
-	size_t num_bytes_send;
-
-	num_bytes_send = SEGGER_RTT_WriteNoLock(
-				  CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-				  data, data_len);
-
-	while (num_bytes_send != data_len) {
+	while (!transport->info_write(data, data_len)) {
 		/* Give host time to read the data and free some space
 		 * in the buffer. */
 		k_sleep(K_MSEC(100));
-		num_bytes_send = SEGGER_RTT_WriteNoLock(
-				  CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-				  data, data_len);
 
 		/* Avoid being blocked in while loop if host does not read
-		 * the RTT data.
+		 * the data.
 		 */
 		retry_cnt++;
 		if (retry_cnt > retry_cnt_max) {
@@ -92,6 +117,21 @@ static int send_info_data(const char *data, size_t data_len)
 	return 0;
 }
 
+static int send_event_descriptions(size_t first, size_t count)
+{
+	char end_line = '\n';
+	int err = 0;
+
+	for (size_t t = first; ((t < count) && !err); t++) {
+		err = send_info_data(descr[t], strlen(descr[t]));
+		if (!err) {
+			err = send_info_data(&end_line, 1);
+		}
+	}
+
+	return err;
+}
+
 static void send_system_description(void)
 {
 	/* Memory barrier to make sure that data is visible
@@ -99,30 +139,146 @@ static void send_system_description(void)
 	 */
 	uint8_t ne = nrf_profiler_num_events;
 
-	__DMB();
+	barrier_dmem_fence_full();
 	char end_line = '\n';
-	int err = 0;
 
-	for (size_t t = 0; ((t < ne) && !err); t++) {
-		err = send_info_data(descr[t], strlen(descr[t]));
-		if (!err) {
-			err = send_info_data(&end_line, 1);
+	if (!send_event_descriptions(0, ne)) {
+		(void)send_info_data(&end_line, 1);
+	}
+}
+
+/* Used by transports without a host to request the system description. */
+static void push_new_descriptions(void)
+{
+	static uint8_t sent;
+	uint8_t ne = nrf_profiler_num_events;
+
+	barrier_dmem_fence_full();
+	if ((sent < ne) && !send_event_descriptions(sent, ne)) {
+		sent = ne;
+	}
+}
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_STAGING
+static inline atomic_t *staging_hdr(struct staging_ring *ring, size_t pos)
+{
+	return (atomic_t *)&ring->buf[pos];
+}
+
+static bool staging_put(const uint8_t *data, size_t len)
+{
+	struct staging_ring *ring = &staging_rings[arch_proc_id()];
+	size_t rec_len = STAGING_ALIGN + ROUND_UP(len, STAGING_ALIGN);
+	atomic_val_t head;
+	size_t used;
+	size_t pos;
+	size_t pad_len;
+
+	do {
+		head = atomic_get(&ring->head);
+		/* Unsigned arithmetic, the indexes wrap around. */
+		used = (size_t)head - (size_t)atomic_get(&ring->tail);
+		pos = head & (STAGING_SIZE - 1);
+		/* Records do not wrap around, the end of the buffer is skipped instead. */
+		pad_len = (STAGING_SIZE - pos < rec_len) ? (STAGING_SIZE - pos) : 0;
+
+		if (used + pad_len + rec_len > STAGING_SIZE) {
+			return false;
 		}
+	} while (!atomic_cas(&ring->head, head, head + pad_len + rec_len));
+
+	if (pad_len) {
+		atomic_set(staging_hdr(ring, pos),
+			   STAGING_HDR_COMMITTED | STAGING_HDR_PADDING | pad_len);
+		pos = 0;
 	}
-	if (!err) {
-		(void)send_info_data(&end_line, 1);
+
+	memcpy(&ring->buf[pos + STAGING_ALIGN], data, len);
+	/* Atomic store orders the data before the header. */
+	atomic_set(staging_hdr(ring, pos), STAGING_HDR_COMMITTED | len);
+
+	/* Wake the thread up once the ring gets half full instead of waiting
+	 * for the drain period to expire.
+	 */
+	if ((used < STAGING_SIZE / 2) && (used + pad_len + rec_len >= STAGING_SIZE / 2)) {
+		k_wakeup(protocol_thread_id);
 	}
+
+	return true;
 }
 
+static bool staging_ring_drain(struct staging_ring *ring)
+{
+	atomic_val_t tail = atomic_get(&ring->tail);
+
+	while (tail != atomic_get(&ring->head)) {
+		size_t pos = tail & (STAGING_SIZE - 1);
+		atomic_val_t hdr = atomic_get(staging_hdr(ring, pos));
+		size_t len = hdr & STAGING_HDR_LEN_MASK;
+		size_t rec_len;
+
+		if (!(hdr & STAGING_HDR_COMMITTED)) {
+			/* Producer is still copying the event. */
+			break;
+		}
+
+		if (hdr & STAGING_HDR_PADDING) {
+			rec_len = len;
+		} else {
+			if (!transport->data_write(&ring->buf[pos + STAGING_ALIGN], len)) {
+				/* Transport is full, keep the event staged. */
+				return false;
+			}
+			rec_len = STAGING_ALIGN + ROUND_UP(len, STAGING_ALIGN);
+		}
+
+		memset(&ring->buf[pos], 0, rec_len);
+		tail += rec_len;
+		atomic_set(&ring->tail, tail);
+	}
+
+	return true;
+}
+
+static void staging_drops_report(void)
+{
+	atomic_val_t dropped = atomic_get(&staging_dropped);
+	struct log_event_buf buf;
+
+	if (dropped == 0) {
+		return;
+	}
+
+	nrf_profiler_log_start(&buf);
+	nrf_profiler_log_encode_uint32(&buf, dropped);
+	buf.payload_start[0] = (uint8_t)drop_event_id;
+
+	if (transport->data_write(buf.payload_start, buf.payload - buf.payload_start)) {
+		atomic_sub(&staging_dropped, dropped);
+	}
+}
+
+static void staging_drain(void)
+{
+	bool drained = true;
+
+	for (size_t i = 0; i < ARRAY_SIZE(staging_rings); i++) {
+		drained = staging_ring_drain(&staging_rings[i]) && drained;
+	}
+
+	if (drained) {
+		staging_drops_report();
+	}
+}
+#endif /* CONFIG_NRF_PROFILER_NORDIC_STAGING */
+
 static void nrf_profiler_nordic_thread_fn(void)
 {
 	while (atomic_get(&nrf_profiler_state) != STATE_TERMINATED) {
 		uint8_t read_data;
 		enum nordic_command command;
 
-		if (SEGGER_RTT_Read(
-		     CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
-		     &read_data, sizeof(read_data))) {
+		if (transport->command_read(&read_data)) {
 			command = (enum nordic_command)read_data;
 			switch (command) {
 			case NORDIC_COMMAND_START:
@@ -139,7 +295,25 @@ static void nrf_profiler_nordic_thread_fn(void)
 				break;
 			}
 		}
+		if (transport->push_descriptions) {
+			push_new_descriptions();
+		}
+#ifdef CONFIG_NRF_PROFILER_NORDIC_STAGING
+		staging_drain();
+		k_sleep(K_MSEC(CONFIG_NRF_PROFILER_NORDIC_STAGING_DRAIN_PERIOD_MS));
+#else
 		k_sleep(K_MSEC(500));
+#endif
+	}
+#ifdef CONFIG_NRF_PROFILER_NORDIC_STAGING
+	/* Flush the events logged before termination. */
+	staging_drain();
+#endif
+	if (transport->push_descriptions) {
+		char end_line = '\n';
+
+		push_new_descriptions();
+		(void)send_info_data(&end_line, 1);
 	}
 	k_sem_give(&nrf_profiler_sem);
 }
@@ -160,35 +334,13 @@ int nrf_profiler_init(void)
 		}
 	}
 
-	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_START_LOGGING_ON_SYSTEM_START)) {
-		atomic_cas(&nrf_profiler_state, STATE_INACTIVE, STATE_ACTIVE);
-	}
+	int ret = transport->init();
 
-	int ret;
-
-	ret = SEGGER_RTT_ConfigUpBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
-		"Nordic nrf_profiler data",
-		buffer_data,
-		CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
-
-	ret = SEGGER_RTT_ConfigUpBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-		"Nordic nrf_profiler info",
-		buffer_info,
-		CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
-
-	ret = SEGGER_RTT_ConfigDownBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
-		"Nordic nrf_profiler command",
-		buffer_commands,
-		CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
+	if (ret) {
+		atomic_set(&nrf_profiler_state, STATE_DISABLED);
+		k_sched_unlock();
+		return ret;
+	}
 
 	protocol_thread_id =  k_thread_create(&nrf_profiler_nordic_thread,
 			nrf_profiler_nordic_stack,
@@ -197,10 +349,26 @@ int nrf_profiler_init(void)
 			NULL, NULL, NULL,
 			CONFIG_NRF_PROFILER_NORDIC_THREAD_PRIORITY, 0, K_NO_WAIT);
 
+	/* Logging is started after the thread is created, as producers wake it up */
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_START_LOGGING_ON_SYSTEM_START)) {
+		atomic_cas(&nrf_profiler_state, STATE_INACTIVE, STATE_ACTIVE);
+	}
+
 	/* Registering fatal error event */
 	fatal_error_event_id = nrf_profiler_register_event_type("_nrf_profiler_fatal_error_event_",
 							    NULL, NULL, 0);
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_STAGING
+	/* Registering event reporting the number of events dropped because
+	 * the staging buffer was full
+	 */
+	static const char * const drop_arg_names[] = {"dropped"};
+	static const enum nrf_profiler_arg drop_arg_types[] = {NRF_PROFILER_ARG_U32};
+
+	drop_event_id = nrf_profiler_register_event_type("_nrf_profiler_drop_event_",
+							 drop_arg_names, drop_arg_types, 1);
+#endif
+
 	k_sched_unlock();
 	return 0;
 }
@@ -262,7 +430,7 @@ uint16_t nrf_profiler_register_event_type(const char *name, const char * const *
 	/* Memory barrier to make sure that data is visible
 	 * before being accessed
 	 */
-	__DMB();
+	barrier_dmem_fence_full();
 	nrf_profiler_num_events++;
 	k_sched_unlock();
 
@@ -340,15 +508,13 @@ void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
 	nrf_profiler_log_encode_uint32(buf, (uint32_t)mem_address);
 }
 
-static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id)
+#ifndef CONFIG_NRF_PROFILER_NORDIC_STAGING
+static bool nrf_profiler_transport_send(struct log_event_buf *buf, uint8_t type_id)
 {
 	buf->payload_start[0] = type_id;
 	size_t data_len = buf->payload - buf->payload_start;
 
-	size_t num_bytes_send = SEGGER_RTT_WriteNoLock(
-			CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
-			buf->payload_start, data_len);
-	return (num_bytes_send == data_len);
+	return transport->data_write(buf->payload_start, data_len);
 }
 
 static void nrf_profiler_fatal_error(void)
@@ -358,12 +524,13 @@ static void nrf_profiler_fatal_error(void)
 	nrf_profiler_log_start(&buf);
 	while (true) {
 		/* Sending Fatal Error event */
-		if (nrf_profiler_RTT_send(&buf, (uint8_t)fatal_error_event_id)) {
+		if (nrf_profiler_transport_send(&buf, (uint8_t)fatal_error_event_id)) {
 			break;
 		}
 	}
 	k_oops();
 }
+#endif /* !CONFIG_NRF_PROFILER_NORDIC_STAGING */
 
 void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 {
@@ -372,11 +539,18 @@ void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 	if (atomic_get(&nrf_profiler_state) == STATE_ACTIVE) {
 		uint8_t type_id = event_type_id & UINT8_MAX;
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_STAGING
+		buf->payload_start[0] = type_id;
+		if (!staging_put(buf->payload_start, buf->payload - buf->payload_start)) {
+			atomic_inc(&staging_dropped);
+		}
+#else
 		k_spinlock_key_t key = k_spin_lock(&lock);
 
-		if (!nrf_profiler_RTT_send(buf, type_id)) {
+		if (!nrf_profiler_transport_send(buf, type_id)) {
 			nrf_profiler_fatal_error();
 		}
 		k_spin_unlock(&lock, key);
+#endif
 	}
 }
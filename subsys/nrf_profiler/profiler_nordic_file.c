@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+
+#include "profiler_nordic_transport.h"
+#include "profiler_nordic_file_bottom.h"
+
+static int data_fd = -1;
+static int info_fd = -1;
+
+static int file_init(void)
+{
+	data_fd = nrf_profiler_file_bottom_open(CONFIG_NRF_PROFILER_NORDIC_FILE_DATA_PATH);
+	info_fd = nrf_profiler_file_bottom_open(CONFIG_NRF_PROFILER_NORDIC_FILE_INFO_PATH);
+
+	if ((data_fd < 0) || (info_fd < 0)) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static bool file_data_write(const uint8_t *data, size_t len)
+{
+	return nrf_profiler_file_bottom_write(data_fd, data, len) == 0;
+}
+
+static bool file_info_write(const uint8_t *data, size_t len)
+{
+	return nrf_profiler_file_bottom_write(info_fd, data, len) == 0;
+}
+
+static bool file_command_read(uint8_t *command)
+{
+	/* There is no host to send commands. */
+	return false;
+}
+
+const struct nrf_profiler_nordic_transport nrf_profiler_nordic_transport = {
+	.init = file_init,
+	.data_write = file_data_write,
+	.info_write = file_info_write,
+	.command_read = file_command_read,
+	.push_descriptions = true,
+};
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILER_NORDIC_FILE_BOTTOM_H_
+#define _PROFILER_NORDIC_FILE_BOTTOM_H_
+
+/* Host side of the native_sim file transport. This header is included by both
+ * the embedded and the host code, so it must not depend on Zephyr headers.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Create or truncate a host file for writing. Returns a file descriptor or -1. */
+int nrf_profiler_file_bottom_open(const char *path);
+
+/** Write all bytes to a host file. Returns 0 on success or -1 on failure. */
+int nrf_profiler_file_bottom_write(int fd, const void *data, unsigned long len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PROFILER_NORDIC_FILE_BOTTOM_H_ */
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILER_NORDIC_TRANSPORT_H_
+#define _PROFILER_NORDIC_TRANSPORT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Transport used by the Nordic nrf_profiler to exchange data with the host.
+ *
+ * Exactly one transport is compiled in, selected with the
+ * NRF_PROFILER_NORDIC_TRANSPORT Kconfig choice.
+ */
+struct nrf_profiler_nordic_transport {
+	/** Initialize the transport. Called once from nrf_profiler_init(). */
+	int (*init)(void);
+
+	/** Write event data. Either all bytes are written or none of them.
+	 *  Called from any context if staging is disabled, otherwise only
+	 *  from the nrf_profiler thread.
+	 *
+	 *  @return true if the data was written, false if there is no space.
+	 */
+	bool (*data_write)(const uint8_t *data, size_t len);
+
+	/** Write system description data. Called from the nrf_profiler thread.
+	 *
+	 *  @return true if the data was written, false if there is no space.
+	 */
+	bool (*info_write)(const uint8_t *data, size_t len);
+
+	/** Read a single command byte sent by the host, if there is one. */
+	bool (*command_read)(uint8_t *command);
+
+	/** The host cannot request the system description, so event
+	 *  descriptions are written as soon as the event types are registered.
+	 */
+	bool push_descriptions;
+};
+
+extern const struct nrf_profiler_nordic_transport nrf_profiler_nordic_transport;
+
+#endif /* _PROFILER_NORDIC_TRANSPORT_H_ */
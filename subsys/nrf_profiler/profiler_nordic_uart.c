@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "profiler_nordic_transport.h"
+
+/* Data and info streams are multiplexed on a single UART. Every write is sent
+ * as a frame consisting of a channel byte, a little-endian 16-bit length and
+ * the data. Commands are received as single raw bytes.
+ */
+#define FRAME_CHANNEL_DATA 1
+#define FRAME_CHANNEL_INFO 2
+
+static const struct device *const uart_dev = DEVICE_DT_GET(DT_CHOSEN(ncs_nrf_profiler_uart));
+
+static int uart_init(void)
+{
+	if (!device_is_ready(uart_dev)) {
+		return -ENODEV;
+	}
+
+	return 0;
+}
+
+static void frame_write(uint8_t channel, const uint8_t *data, size_t len)
+{
+	uint8_t header[3];
+
+	__ASSERT_NO_MSG(len <= UINT16_MAX);
+
+	header[0] = channel;
+	sys_put_le16(len, &header[1]);
+
+	for (size_t i = 0; i < sizeof(header); i++) {
+		uart_poll_out(uart_dev, header[i]);
+	}
+	for (size_t i = 0; i < len; i++) {
+		uart_poll_out(uart_dev, data[i]);
+	}
+}
+
+static bool uart_data_write(const uint8_t *data, size_t len)
+{
+	frame_write(FRAME_CHANNEL_DATA, data, len);
+
+	return true;
+}
+
+static bool uart_info_write(const uint8_t *data, size_t len)
+{
+	frame_write(FRAME_CHANNEL_INFO, data, len);
+
+	return true;
+}
+
+static bool uart_command_read(uint8_t *command)
+{
+	return uart_poll_in(uart_dev, command) == 0;
+}
+
+const struct nrf_profiler_nordic_transport nrf_profiler_nordic_transport = {
+	.init = uart_init,
+	.data_write = uart_data_write,
+	.info_write = uart_info_write,
+	.command_read = uart_command_read,
+	.push_descriptions = false,
+};
@@ -4038,11 +4038,104 @@ void test_dect_ft_sckt_packet_rx_tx(void)
 
 	zsock_close(sockfd);
 }
+
+/**
+ * @brief Test sustained RX of packet bursts from an associated child
+ *
+ * Runs after test_dect_ft_sckt_packet_rx_tx. Injects bursts of DLC data from the mock
+ * (dlc_data_rx_ntf) back-to-back, so that the driver RX thread handles each burst as one
+ * batch, and verifies that every packet reaches the packet socket in order with the child
+ * as the source. Logs the achieved RX throughput.
+ */
+void test_dect_ft_sckt_packet_rx_burst(void)
+{
+	struct sockaddr_ll bind_addr = {0};
+	struct sockaddr_ll src;
+	socklen_t fromlen;
+	int sockfd;
+	int ret;
+	/* Child long_rd_id from test_dect_ft_cluster_associate_child_with_global_address */
+	const uint32_t child_long_rd_id = 0xCAFEBABE;
+	const int burst_len = 8;
+	const int rounds = 16;
+	static uint8_t rx_inject_payload[8][96];
+	uint8_t rx_buf[DECT_MTU];
+	uint32_t total_bytes = 0;
+	int64_t start_ms;
+	int64_t elapsed_ms;
+
+	TEST_ASSERT_NOT_NULL_MESSAGE(test_iface, "DECT test iface should be set");
+	TEST_ASSERT_NOT_NULL_MESSAGE(mock_ntf_callbacks.dlc_data_rx_ntf,
+				     "dlc_data_rx_ntf callback should be registered");
+
+	sockfd = zsock_socket(AF_PACKET, SOCK_DGRAM, htons(ETH_P_ALL));
+	TEST_ASSERT_TRUE_MESSAGE(sockfd >= 0, "AF_PACKET SOCK_DGRAM socket should be created");
+
+	bind_addr.sll_family = AF_PACKET;
+	bind_addr.sll_ifindex = net_if_get_by_iface(test_iface);
+
+	ret = zsock_bind(sockfd, (struct sockaddr *)&bind_addr, sizeof(struct sockaddr_ll));
+	TEST_ASSERT_EQUAL_MESSAGE(0, ret, "Bind to DECT iface should succeed");
+
+	struct timeval tv = {.tv_sec = 0, .tv_usec = 300 * 1000};
+
+	ret = zsock_setsockopt(sockfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	TEST_ASSERT_EQUAL_MESSAGE(0, ret, "setsockopt SO_RCVTIMEO should succeed");
+
+	start_ms = k_uptime_get();
+
+	for (int round = 0; round < rounds; round++) {
+		/* Inject a whole burst before the RX thread gets to run */
+		for (int i = 0; i < burst_len; i++) {
+			struct nrf_modem_dect_dlc_data_rx_ntf_cb_params rx_params = {
+				.flow_id = 0,
+				.long_rd_id = child_long_rd_id,
+				.data = rx_inject_payload[i],
+				.data_len = sizeof(rx_inject_payload[i]),
+			};
+
+			memset(rx_inject_payload[i], round * burst_len + i,
+			       sizeof(rx_inject_payload[i]));
+			mock_ntf_callbacks.dlc_data_rx_ntf(&rx_params);
+		}
+
+		for (int i = 0; i < burst_len; i++) {
+			uint32_t src_long_rd_id = 0;
+
+			memset(&src, 0, sizeof(src));
+			fromlen = sizeof(src);
+			ret = zsock_recvfrom(sockfd, rx_buf, sizeof(rx_buf), 0,
+					     (struct sockaddr *)&src, &fromlen);
+
+			TEST_ASSERT_EQUAL_MESSAGE((int)sizeof(rx_inject_payload[i]), ret,
+						  "recvfrom should receive every injected packet");
+			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(rx_inject_payload[i], rx_buf, ret,
+							 "Burst packets should be received in order");
+
+			memcpy(&src_long_rd_id, &src.sll_addr, sizeof(uint32_t));
+			TEST_ASSERT_EQUAL_MESSAGE(child_long_rd_id, ntohl(src_long_rd_id),
+						  "recvfrom source sll_addr should be child long_rd_id");
+			total_bytes += ret;
+		}
+	}
+
+	elapsed_ms = MAX(k_uptime_get() - start_ms, 1);
+
+	LOG_INF("RX burst: %d packets, %u bytes in %lld ms (%lld kbit/s)", rounds * burst_len,
+		total_bytes, elapsed_ms, ((int64_t)total_bytes * 8) / elapsed_ms);
+
+	zsock_close(sockfd);
+}
 #else
 void test_dect_ft_sckt_packet_rx_tx(void)
 {
 	TEST_IGNORE_MESSAGE("CONFIG_NET_SOCKETS_PACKET_DGRAM not enabled");
 }
+
+void test_dect_ft_sckt_packet_rx_burst(void)
+{
+	TEST_IGNORE_MESSAGE("CONFIG_NET_SOCKETS_PACKET_DGRAM not enabled");
+}
 #endif
 
 /**
@@ -8,17 +8,19 @@
 #include <ei_run_classifier.h>
 
 static size_t prediction_idx;
+static size_t slice_cnt;
 
 void ei_run_classifier_mock_init(void)
 {
 	prediction_idx = 0;
+	slice_cnt = 0;
 }
 
 /* Input data must be ascending sequence of floats. Difference between
  * subsequent elements of input sequence equals 1. The first element
  * has value defined by ei_test_params.h (depends on current prediction idx).
  */
-static void verify_data_read(signal_t *signal, const size_t prediction_idx,
+static void verify_data_read(signal_t *signal, const float first_value,
 			     const size_t chunk_size)
 {
 	size_t data_size = signal->total_length;
@@ -37,7 +39,7 @@ static void verify_data_read(signal_t *signal, const size_t prediction_idx,
 		zassert_ok(err, "get_data returned an error");
 	}
 
-	float value = EI_MOCK_GEN_FIRST_INPUT(prediction_idx);;
+	float value = first_value;
 
 	for (size_t off = 0; off < data_size; off++) {
 		zassert_within(data_buf[off], value, FLOAT_CMP_EPSILON,
@@ -46,22 +48,8 @@ static void verify_data_read(signal_t *signal, const size_t prediction_idx,
 	}
 }
 
-EI_IMPULSE_ERROR run_classifier(signal_t *signal,
-				ei_impulse_result_t *result,
-				bool debug)
+static void fill_result(ei_impulse_result_t *result)
 {
-	ARG_UNUSED(debug);
-
-	/* Test getting data. */
-	verify_data_read(signal, prediction_idx, 1);
-	verify_data_read(signal, prediction_idx,
-			 EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME);
-	verify_data_read(signal, prediction_idx,
-			 EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
-
-	/* Busy wait for predefined amount of time to simulate calculations. */
-	k_busy_wait(EI_MOCK_BUSY_WAIT_TIME);
-
 	/* Timing results. */
 	result->timing.dsp = EI_MOCK_GEN_DSP_TIME(prediction_idx);
 	result->timing.classification = EI_MOCK_GEN_CLASSIFICATION_TIME(prediction_idx);
@@ -88,6 +76,67 @@ EI_IMPULSE_ERROR run_classifier(signal_t *signal,
 		      "Wrong label");
 
 	prediction_idx++;
+}
+
+EI_IMPULSE_ERROR run_classifier(signal_t *signal,
+				ei_impulse_result_t *result,
+				bool debug)
+{
+	ARG_UNUSED(debug);
+
+	float first_value = EI_MOCK_GEN_FIRST_INPUT(prediction_idx);
+
+	zassert_equal(signal->total_length, EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE,
+		      "Wrong signal length");
+
+	/* Test getting data. */
+	verify_data_read(signal, first_value, 1);
+	verify_data_read(signal, first_value, EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME);
+	verify_data_read(signal, first_value, EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+
+	/* Busy wait for predefined amount of time to simulate calculations. */
+	k_busy_wait(EI_MOCK_BUSY_WAIT_TIME);
+
+	fill_result(result);
+
+	return EI_IMPULSE_OK;
+}
+
+void run_classifier_init(void)
+{
+	slice_cnt = 0;
+}
+
+/* Slices of the first window are provided in order. Afterwards, every slice completes
+ * a window shifted by the slice size.
+ */
+EI_IMPULSE_ERROR run_classifier_continuous(signal_t *signal,
+					   ei_impulse_result_t *result,
+					   bool debug,
+					   bool enable_maf)
+{
+	ARG_UNUSED(debug);
+	ARG_UNUSED(enable_maf);
+
+	size_t slice_idx = MIN(slice_cnt, EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW - 1);
+	float first_value = EI_MOCK_GEN_FIRST_INPUT(prediction_idx) +
+			    slice_idx * EI_CLASSIFIER_SLICE_SIZE;
+
+	zassert_equal(signal->total_length, EI_CLASSIFIER_SLICE_SIZE, "Wrong signal length");
+
+	verify_data_read(signal, first_value, 1);
+	verify_data_read(signal, first_value, EI_CLASSIFIER_SLICE_SIZE);
+
+	k_busy_wait(EI_MOCK_BUSY_WAIT_TIME / EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW);
+
+	slice_cnt++;
+
+	if (slice_cnt < EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW) {
+		/* Window is not complete yet. The wrapper ignores the result. */
+		memset(result, 0, sizeof(*result));
+	} else {
+		fill_result(result);
+	}
 
 	return EI_IMPULSE_OK;
 }
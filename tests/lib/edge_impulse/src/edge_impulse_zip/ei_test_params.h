@@ -18,6 +18,9 @@
 #define EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE	300
 #define EI_CLASSIFIER_HAS_ANOMALY		1
 #define EI_CLASSIFIER_FREQUENCY			60
+#define EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW	20
+#define EI_CLASSIFIER_SLICE_SIZE		(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE / \
+						 EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW)
 
 /* Mocked results. */
 static const char * const ei_classifier_inferencing_categories[] = {
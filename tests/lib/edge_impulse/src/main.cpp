@@ -21,6 +21,7 @@ static size_t timer_fn_calls;
 static atomic_t rerun_in_cb;
 
 static size_t prediction_idx;
+static struct ei_wrapper_timing last_timing;
 /* Semaphore is used to wait until ei_wrapper returns prediction results. */
 static K_SEM_DEFINE(test_sem, 0, 1)
 
@@ -107,6 +108,17 @@ static void verify_result(const size_t pred_idx)
 	zassert_equal(classification_time, EI_MOCK_GEN_CLASSIFICATION_TIME(pred_idx),
 		      "Wrong classification time");
 	zassert_equal(anomaly_time, EI_MOCK_GEN_ANOMALY_TIME(pred_idx), "Wrong anomaly time");
+
+	err = ei_wrapper_get_timing_details(&last_timing);
+	zassert_ok(err, "ei_wrapper_get_timing_details returned an error");
+
+	zassert_equal(last_timing.dsp_time, dsp_time, "Wrong DSP time");
+	zassert_equal(last_timing.classification_time, classification_time,
+		      "Wrong classification time");
+	zassert_equal(last_timing.anomaly_time, anomaly_time, "Wrong anomaly time");
+	zassert_true(last_timing.dsp_input_size > 0, "Wrong DSP input size");
+	zassert_true(last_timing.dsp_input_size <= EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE,
+		     "Wrong DSP input size");
 }
 
 static void run_basic_setup(const size_t pred_idx,
@@ -240,6 +252,32 @@ ZTEST(suite0, test_data_add_fail)
 	zassert_true(err, "Expected error adding data with improper size");
 }
 
+ZTEST(suite0, test_data_int16)
+{
+	static int16_t data_buf[EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE];
+	int16_t value = (int16_t)EI_MOCK_GEN_FIRST_INPUT(prediction_idx);
+
+	for (size_t i = 0; i < ARRAY_SIZE(data_buf); i++) {
+		data_buf[i] = value;
+		value++;
+	}
+
+	int err = ei_wrapper_add_data_int16(data_buf, ARRAY_SIZE(data_buf));
+
+	if (!IS_ENABLED(CONFIG_EI_WRAPPER_DATA_INT16)) {
+		zassert_equal(err, -ENOTSUP, "Integer data should not be supported");
+		return;
+	}
+
+	zassert_ok(err, "Cannot add input data");
+
+	err = ei_wrapper_start_prediction(0, 0);
+	zassert_ok(err, "Cannot start prediction");
+
+	err = k_sem_take(&test_sem, EI_TEST_SEM_TIMEOUT);
+	zassert_ok(err, "Cannot take semaphore");
+}
+
 ZTEST(suite0, test_double_start)
 {
 	int err;
@@ -344,6 +382,16 @@ ZTEST(suite0, test_sliding_window)
 		zassert_ok(err, "Cannot start prediction");
 		err = k_sem_take(&test_sem, EI_TEST_SEM_TIMEOUT);
 		zassert_ok(err, "Cannot take semaphore");
+
+		/* Window shifted by a single slice reuses the cached features. */
+		size_t dsp_input_size = EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE;
+
+		if (IS_ENABLED(CONFIG_EI_WRAPPER_INCREMENTAL) && (i > 0)) {
+			dsp_input_size = EI_CLASSIFIER_SLICE_SIZE;
+		}
+
+		zassert_equal(last_timing.dsp_input_size, dsp_input_size,
+			      "Wrong DSP input size");
 	}
 }
 
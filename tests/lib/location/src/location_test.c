@@ -74,6 +74,8 @@ int net_mgmt_NET_REQUEST_WIFI_SCAN(
 
 static struct location_event_data test_location_event_data[5] = {0};
 static struct nrf_modem_gnss_pvt_data_frame test_pvt_data = {0};
+/* Latest event received by location_event_handler() */
+static struct location_event_data test_location_event_latest;
 static int location_cb_occurred;
 static int location_cb_expected;
 static int location_cb_occurred_2;
@@ -322,6 +324,7 @@ static void location_event_handler(const struct location_event_data *event_data)
 	struct location_event_data *expected = &test_location_event_data[location_cb_occurred];
 
 	location_event_data_verify(expected, event_data);
+	test_location_event_latest = *event_data;
 
 	location_cb_occurred++;
 
@@ -1427,6 +1430,32 @@ void test_error_wifi_cellular_method(void)
 	TEST_ASSERT_EQUAL(-EINVAL, err);
 }
 
+/* Test location request with invalid LOCATION_REQ_MODE_CONCURRENT configurations. */
+void test_error_mode_concurrent(void)
+{
+	int err;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {
+		LOCATION_METHOD_GNSS,
+		LOCATION_METHOD_CELLULAR,
+		LOCATION_METHOD_GNSS};
+
+	/* Negative accuracy target */
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_target = -1.0f;
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(-EINVAL, err);
+
+	/* Same method given twice */
+	location_config_defaults_set(&config, 3, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(-EINVAL, err);
+}
+
 /* Test cancelling location request when there is no pending location request. */
 void test_error_cancel_no_operation(void)
 {
@@ -1992,6 +2021,292 @@ void test_location_request_mode_all_cellular_error_gnss_timeout(void)
 	k_sleep(K_MSEC(1));
 }
 
+/********* TESTS CONCURRENT POSITIONING REQUESTS ***********************/
+
+/* Simulated time for GNSS to get a fix in the concurrent tests */
+#define CONCURRENT_GNSS_FIX_TIME_MS 200
+
+/* Sets the expectations for starting GNSS in the concurrent tests. GNSS is started when
+ * "+CSCON: 0" is dispatched. A-GNSS data is valid so that no assistance is requested.
+ */
+static void concurrent_gnss_start_expect(void)
+{
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+
+#if defined(CONFIG_LOCATION_TEST_AGNSS)
+	static struct nrf_modem_gnss_agnss_expiry agnss_expiry = {
+		.data_flags = 0,
+		.utc_expiry = 0xffff,
+		.klob_expiry = 0xffff,
+		.neq_expiry = 0xffff,
+		.integrity_expiry = 0xffff,
+		.position_expiry = 0xffff };
+
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ExpectAndReturn(NULL, 0);
+	__cmock_nrf_modem_gnss_agnss_expiry_get_IgnoreArg_agnss_expiry();
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ReturnMemThruPtr_agnss_expiry(
+		&agnss_expiry, sizeof(agnss_expiry));
+#endif
+	__cmock_nrf_modem_gnss_fix_interval_set_ExpectAndReturn(1, 0);
+	__cmock_nrf_modem_gnss_use_case_set_ExpectAndReturn(
+		NRF_MODEM_GNSS_USE_CASE_MULTIPLE_HOT_START, 0);
+	__cmock_nrf_modem_gnss_start_ExpectAndReturn(0);
+
+	__mock_nrf_modem_at_scanf_ExpectAndReturn(
+		"AT%XSYSTEMMODE?", "%%XSYSTEMMODE: %d,%d,%d,%d,%d", 4);
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* LTE-M support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* NB-IoT support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* GNSS support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(0); /* LTE preference */
+
+#if !defined(CONFIG_LOCATION_TEST_AGNSS)
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT%%XMONITOR", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)xmonitor_resp, sizeof(xmonitor_resp));
+#endif
+}
+
+/* Sets up the test PVT data and the expected location event for a GNSS fix. */
+static void concurrent_gnss_fix_expect(float accuracy)
+{
+	test_pvt_data.flags = NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID;
+	test_pvt_data.latitude = 61.005;
+	test_pvt_data.longitude = -45.997;
+	test_pvt_data.accuracy = accuracy;
+	test_pvt_data.datetime.year = 2021;
+	test_pvt_data.datetime.month = 8;
+	test_pvt_data.datetime.day = 13;
+	test_pvt_data.datetime.hour = 12;
+	test_pvt_data.datetime.minute = 34;
+	test_pvt_data.datetime.seconds = 56;
+	test_pvt_data.datetime.ms = 789;
+	for (int i = 0; i < 5; i++) {
+		test_pvt_data.sv[i].sv = 2 * (i + 1);
+		test_pvt_data.sv[i].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	}
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	test_location_event_data[location_cb_expected].location.latitude = 61.005;
+	test_location_event_data[location_cb_expected].location.longitude = -45.997;
+	test_location_event_data[location_cb_expected].location.accuracy = accuracy;
+	test_location_event_data[location_cb_expected].location.datetime.valid = true;
+	test_location_event_data[location_cb_expected].location.datetime.year = 2021;
+	test_location_event_data[location_cb_expected].location.datetime.month = 8;
+	test_location_event_data[location_cb_expected].location.datetime.day = 13;
+	test_location_event_data[location_cb_expected].location.datetime.hour = 12;
+	test_location_event_data[location_cb_expected].location.datetime.minute = 34;
+	test_location_event_data[location_cb_expected].location.datetime.second = 56;
+	test_location_event_data[location_cb_expected].location.datetime.ms = 789;
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].location.details.gnss.satellites_tracked = 5;
+	test_location_event_data[location_cb_expected].location.details.gnss.satellites_used = 5;
+	test_location_event_data[location_cb_expected].location.details.gnss.pvt_data =
+		test_pvt_data;
+#endif
+	location_cb_expected++;
+}
+
+/* Sets up the expected location event for a cellular location. */
+static void concurrent_cellular_location_expect(void)
+{
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	test_location_event_data[location_cb_expected].location.latitude = 61.50375;
+	test_location_event_data[location_cb_expected].location.longitude = 23.896979;
+	test_location_event_data[location_cb_expected].location.accuracy = 750.0;
+	test_location_event_data[location_cb_expected].location.datetime.valid = false;
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].location.details.cellular.ncells_count = 1;
+	test_location_event_data[location_cb_expected].location.details.cellular.gci_cells_count =
+		0;
+#endif
+	location_cb_expected++;
+}
+
+/* Starts a concurrent location request with GNSS and cellular methods. */
+static void concurrent_location_request(float accuracy_target, int32_t timeout)
+{
+	int err;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_target = accuracy_target;
+	config.timeout = timeout;
+	config.methods[0].gnss.timeout = 120 * MSEC_PER_SEC;
+	config.methods[1].cellular.cell_count = 1;
+
+	concurrent_gnss_start_expect();
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS=1", 0);
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+	k_sleep(K_MSEC(1));
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_STARTED of both methods */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#endif
+
+	/* GNSS is started once RRC connection is released */
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+}
+
+static void concurrent_started_events_expect(void)
+{
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	location_cb_expected++;
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+#endif
+}
+
+/* Completes the cellular scan and returns the location from the external cloud service. */
+static void concurrent_cellular_location_respond(void)
+{
+	int err;
+	struct location_data location_data = {
+		.latitude = 61.50375,
+		.longitude = 23.896979,
+		.accuracy = 750.0,
+		.datetime.valid = false
+	};
+
+	at_monitor_dispatch(ncellmeas_resp_pci1);
+
+	/* Wait for LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+
+	location_cloud_location_ext_result_set(LOCATION_EXT_RESULT_SUCCESS, &location_data);
+	k_sleep(K_MSEC(1));
+}
+
+static void concurrent_cloud_location_ext_request_expect(void)
+{
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+}
+
+/* Reports a GNSS fix with the current test PVT data. */
+static void concurrent_gnss_fix_report(void)
+{
+	__cmock_nrf_modem_gnss_read_ExpectAndReturn(
+		NULL, sizeof(test_pvt_data), NRF_MODEM_GNSS_DATA_PVT, 0);
+	__cmock_nrf_modem_gnss_read_IgnoreArg_buf();
+	__cmock_nrf_modem_gnss_read_ReturnMemThruPtr_buf(&test_pvt_data, sizeof(test_pvt_data));
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+	method_gnss_event_handler(NRF_MODEM_GNSS_EVT_PVT);
+	k_sleep(K_MSEC(1));
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where the GNSS fix meets the accuracy target while
+ * cellular positioning is still scanning. The result is returned without waiting for
+ * cellular positioning, which is cancelled.
+ */
+void test_location_concurrent_first_fix_meets_target(void)
+{
+	int err;
+	int64_t start_uptime;
+
+	concurrent_started_events_expect();
+	concurrent_gnss_fix_expect(15.83);
+
+	start_uptime = k_uptime_get();
+	concurrent_location_request(50.0f, SYS_FOREVER_MS);
+
+	/* Simulate the time GNSS takes to get a fix */
+	k_sleep(K_MSEC(CONCURRENT_GNSS_FIX_TIME_MS));
+
+	/* Cellular scan is still running when the result has been decided */
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEASSTOP", 0);
+
+	concurrent_gnss_fix_report();
+
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* Time to fix is the GNSS fix time, not limited by the cellular scan */
+	TEST_ASSERT_GREATER_OR_EQUAL(
+		CONCURRENT_GNSS_FIX_TIME_MS, (int)(k_uptime_get() - start_uptime));
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	TEST_ASSERT_GREATER_OR_EQUAL(
+		CONCURRENT_GNSS_FIX_TIME_MS,
+		test_location_event_latest.location.details.elapsed_time_method);
+#endif
+
+	/* Need to wait a bit because no %NCELLMEAS notification is sent after AT%NCELLMEASSTOP. */
+	k_sleep(K_MSEC(2100));
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where neither method meets the accuracy target.
+ * The most accurate location is returned once both methods have completed.
+ */
+void test_location_concurrent_best_result(void)
+{
+	concurrent_started_events_expect();
+	concurrent_cloud_location_ext_request_expect();
+	concurrent_gnss_fix_expect(15.83);
+
+	concurrent_location_request(5.0f, SYS_FOREVER_MS);
+
+	/* Cellular location does not meet the target and GNSS is still running */
+	concurrent_cellular_location_respond();
+	TEST_ASSERT_EQUAL(location_cb_expected - 1, location_cb_occurred);
+
+	/* GNSS does not meet the target either but is more accurate */
+	concurrent_gnss_fix_report();
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where neither method gets a location before
+ * the timeout of the request. Both methods are stopped.
+ */
+void test_location_concurrent_timeout(void)
+{
+	concurrent_started_events_expect();
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_TIMEOUT;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	location_cb_expected++;
+
+	concurrent_location_request(5.0f, 500);
+
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEASSTOP", 0);
+
+	/* Wait for the timeout, and because no %NCELLMEAS notification is sent after
+	 * AT%NCELLMEASSTOP.
+	 */
+	k_sleep(K_MSEC(2600));
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where the cellular location meets the accuracy target.
+ * GNSS, which is still searching for a fix, is cancelled.
+ */
+void test_location_concurrent_losing_method_cancelled(void)
+{
+	concurrent_started_events_expect();
+	concurrent_cloud_location_ext_request_expect();
+	concurrent_cellular_location_expect();
+
+	concurrent_location_request(1000.0f, SYS_FOREVER_MS);
+
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+
+	concurrent_cellular_location_respond();
+}
+
 /********* TESTS PERIODIC POSITIONING REQUESTS ***********************/
 
 /* Test periodic location request and cancel it once some iterations are done. */
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Location library configuration used by the cache under test */
+#define CONFIG_LOCATION_LOG_LEVEL 0
+#define CONFIG_LOCATION_SERVICE_CLOUD_CACHE 1
+#define CONFIG_LOCATION_SERVICE_CLOUD_CACHE_SIZE 4
+#define CONFIG_LOCATION_SERVICE_CLOUD_CACHE_NEIGHBORS 4
+#define CONFIG_LOCATION_SERVICE_CLOUD_CACHE_APS 8
+#define CONFIG_LOCATION_SERVICE_CLOUD_CACHE_THRESHOLD 60
+#define CONFIG_LOCATION_SERVICE_CLOUD_CACHE_ACCURACY_AGING 10
+#define CONFIG_LOCATION_SERVICE_CLOUD_CACHE_MAX_AGE 2
+
+/* Required by zephyr/net/wifi_mgmt.h */
+#define CONFIG_WIFI_MGMT_RAW_SCAN_RESULT_LENGTH 10
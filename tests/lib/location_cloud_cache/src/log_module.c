@@ -0,0 +1,10 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/logging/log.h>
+
+/* Normally registered by the location library core which is not part of this test */
+LOG_MODULE_REGISTER(location, CONFIG_LOCATION_LOG_LEVEL);
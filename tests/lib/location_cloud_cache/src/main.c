@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+#include <zephyr/kernel.h>
+
+#include "settings_mock.h"
+
+/* The cache is included directly to be able to reset its state between tests */
+#include "cloud_cache.c"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(int, date_time_now, int64_t *);
+
+#define TEST_TIME_START_MS 1767225600000LL
+#define TEST_HOUR_MS (3600LL * MSEC_PER_SEC)
+
+#define TEST_AP_COUNT_MAX CONFIG_LOCATION_SERVICE_CLOUD_CACHE_APS
+
+static int64_t test_time_ms;
+
+static struct wifi_scan_result test_aps[TEST_AP_COUNT_MAX];
+static struct wifi_scan_info test_wifi_data = {
+	.ap_info = test_aps,
+};
+
+static int date_time_now_custom_fake(int64_t *unix_time_ms)
+{
+	*unix_time_ms = test_time_ms;
+
+	return 0;
+}
+
+static int date_time_now_invalid_fake(int64_t *unix_time_ms)
+{
+	return -ENODATA;
+}
+
+/* Sets access points whose MAC addresses end with the given IDs to the Wi-Fi scan results.
+ * Each access point becomes a separate element in the fingerprint.
+ */
+static const struct wifi_scan_info *test_wifi_data_set(const uint8_t *ids, size_t count)
+{
+	zassert_true(count <= ARRAY_SIZE(test_aps));
+
+	memset(test_aps, 0, sizeof(test_aps));
+	for (int i = 0; i < count; i++) {
+		test_aps[i].mac[WIFI_MAC_ADDR_LEN - 1] = ids[i];
+		test_aps[i].mac_length = WIFI_MAC_ADDR_LEN;
+		test_aps[i].rssi = -50 - i;
+	}
+	test_wifi_data.cnt = count;
+
+	return &test_wifi_data;
+}
+
+#define TEST_WIFI(...) \
+	test_wifi_data_set((const uint8_t[]){ __VA_ARGS__ }, \
+			   sizeof((const uint8_t[]){ __VA_ARGS__ }))
+
+static void test_location_store(const struct wifi_scan_info *wifi_data, double latitude)
+{
+	struct location_data location = {
+		.latitude = latitude,
+		.longitude = 10.0,
+		.accuracy = 50.0f,
+	};
+
+	zassert_equal(cloud_cache_location_store(NULL, wifi_data, &location), 0);
+}
+
+static int test_location_get(const struct wifi_scan_info *wifi_data, double *latitude)
+{
+	struct location_data location = { 0 };
+	int err;
+
+	err = cloud_cache_location_get(NULL, wifi_data, &location);
+	if (err == 0 && latitude != NULL) {
+		*latitude = location.latitude;
+	}
+
+	return err;
+}
+
+static void test_cache_ram_reset(void)
+{
+	memset(cache, 0, sizeof(cache));
+	lru_stamp = 0;
+	loaded = false;
+}
+
+static void test_before(void *fixture)
+{
+	RESET_FAKE(date_time_now);
+	FFF_RESET_HISTORY();
+
+	test_cache_ram_reset();
+	settings_mock_clear();
+
+	test_time_ms = TEST_TIME_START_MS;
+	date_time_now_fake.custom_fake = date_time_now_custom_fake;
+}
+
+ZTEST(location_cloud_cache, test_invalid_time)
+{
+	struct location_data location = {
+		.latitude = 61.0,
+		.longitude = 10.0,
+		.accuracy = 50.0f,
+	};
+	int err;
+
+	date_time_now_fake.custom_fake = date_time_now_invalid_fake;
+
+	err = cloud_cache_location_store(NULL, TEST_WIFI(1, 2, 3, 4), &location);
+	zassert_equal(err, -ENODATA);
+	zassert_equal(settings_mock_save_count(), 0);
+
+	err = cloud_cache_location_get(NULL, TEST_WIFI(1, 2, 3, 4), &location);
+	zassert_equal(err, -ENODATA);
+
+	/* Once the time is valid, nothing stored before is found */
+	date_time_now_fake.custom_fake = date_time_now_custom_fake;
+
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 4), NULL), -ENOENT);
+}
+
+ZTEST(location_cloud_cache, test_empty_fingerprint)
+{
+	struct location_data location = { 0 };
+
+	zassert_equal(cloud_cache_location_store(NULL, NULL, &location), -EINVAL);
+	zassert_equal(test_location_get(NULL, NULL), -ENOENT);
+}
+
+ZTEST(location_cloud_cache, test_overlap_threshold)
+{
+	test_location_store(TEST_WIFI(1, 2, 3, 4), 61.0);
+
+	/* Identical */
+	zassert_equal(test_location_get(TEST_WIFI(4, 3, 2, 1), NULL), 0);
+	/* 3 of 5 elements in common, 60 % */
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 5), NULL), 0);
+	/* 3 of 6 elements in common, 50 % */
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 5, 6), NULL), -ENOENT);
+	/* 2 of 6 elements in common, 33 % */
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 5, 6), NULL), -ENOENT);
+	/* Nothing in common */
+	zassert_equal(test_location_get(TEST_WIFI(5, 6, 7, 8), NULL), -ENOENT);
+}
+
+ZTEST(location_cloud_cache, test_best_match)
+{
+	double latitude;
+
+	/* 5 of 9 elements in common, so these are stored as separate entries */
+	test_location_store(TEST_WIFI(1, 2, 3, 4, 5, 6), 61.0);
+	test_location_store(TEST_WIFI(1, 2, 3, 4, 5, 7, 8, 9), 62.0);
+	zassert_equal(settings_mock_save_count(), 2);
+
+	/* Overlaps of 85 % and 66 % */
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 4, 5, 6, 7), &latitude), 0);
+	zassert_equal(latitude, 61.0);
+
+	/* Overlaps of 62 % and 87 % */
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 4, 5, 7, 8), &latitude), 0);
+	zassert_equal(latitude, 62.0);
+}
+
+ZTEST(location_cloud_cache, test_matching_entry_refreshed)
+{
+	double latitude;
+
+	test_location_store(TEST_WIFI(1, 2, 3, 4), 61.0);
+	test_location_store(TEST_WIFI(1, 2, 3, 5), 62.0);
+
+	/* The second location replaced the first one instead of taking another entry */
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 4), &latitude), 0);
+	zassert_equal(latitude, 62.0);
+	zassert_equal(cache[1].used, 0);
+}
+
+ZTEST(location_cloud_cache, test_lru_eviction)
+{
+	double latitude;
+
+	BUILD_ASSERT(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_SIZE == 4);
+
+	test_location_store(TEST_WIFI(1), 61.0);
+	test_location_store(TEST_WIFI(2), 62.0);
+	test_location_store(TEST_WIFI(3), 63.0);
+	test_location_store(TEST_WIFI(4), 64.0);
+
+	/* Makes the first entry more recently used than the second one */
+	zassert_equal(test_location_get(TEST_WIFI(1), NULL), 0);
+
+	test_location_store(TEST_WIFI(5), 65.0);
+
+	zassert_equal(test_location_get(TEST_WIFI(2), NULL), -ENOENT);
+	zassert_equal(test_location_get(TEST_WIFI(1), &latitude), 0);
+	zassert_equal(latitude, 61.0);
+	zassert_equal(test_location_get(TEST_WIFI(3), &latitude), 0);
+	zassert_equal(latitude, 63.0);
+	zassert_equal(test_location_get(TEST_WIFI(4), &latitude), 0);
+	zassert_equal(latitude, 64.0);
+	zassert_equal(test_location_get(TEST_WIFI(5), &latitude), 0);
+	zassert_equal(latitude, 65.0);
+
+	/* First location is now the least recently used one */
+	test_location_store(TEST_WIFI(6), 66.0);
+
+	zassert_equal(test_location_get(TEST_WIFI(1), NULL), -ENOENT);
+	zassert_equal(test_location_get(TEST_WIFI(6), NULL), 0);
+}
+
+ZTEST(location_cloud_cache, test_max_age)
+{
+	BUILD_ASSERT(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_MAX_AGE == 2);
+
+	test_location_store(TEST_WIFI(1, 2, 3, 4), 61.0);
+
+	test_time_ms += 2 * TEST_HOUR_MS;
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 4), NULL), 0);
+
+	test_time_ms += MSEC_PER_SEC;
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 4), NULL), -ENOENT);
+
+	/* Expired entry does not prevent storing a new location */
+	test_location_store(TEST_WIFI(1, 2, 3, 4), 62.0);
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 4), NULL), 0);
+}
+
+ZTEST(location_cloud_cache, test_accuracy_aging)
+{
+	struct location_data location = { 0 };
+
+	BUILD_ASSERT(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_ACCURACY_AGING == 10);
+
+	test_location_store(TEST_WIFI(1, 2, 3, 4), 61.0);
+
+	zassert_equal(cloud_cache_location_get(NULL, TEST_WIFI(1, 2, 3, 4), &location), 0);
+	zassert_within(location.accuracy, 50.0f, 0.01f);
+	zassert_equal(location.latitude, 61.0);
+	zassert_equal(location.longitude, 10.0);
+
+	/* 10 m per hour */
+	test_time_ms += 90 * 60 * MSEC_PER_SEC;
+	zassert_equal(cloud_cache_location_get(NULL, TEST_WIFI(1, 2, 3, 4), &location), 0);
+	zassert_within(location.accuracy, 65.0f, 0.01f);
+
+	/* Time going backwards does not improve the accuracy */
+	test_time_ms = TEST_TIME_START_MS - TEST_HOUR_MS;
+	zassert_equal(cloud_cache_location_get(NULL, TEST_WIFI(1, 2, 3, 4), &location), 0);
+	zassert_within(location.accuracy, 50.0f, 0.01f);
+}
+
+ZTEST(location_cloud_cache, test_cell_fingerprint)
+{
+	struct lte_lc_ncell neighbors[] = {
+		{ .earfcn = 6400, .phys_cell_id = 1, .rsrp = 50 },
+		{ .earfcn = 6400, .phys_cell_id = 2, .rsrp = 40 },
+		{ .earfcn = 6400, .phys_cell_id = 3, .rsrp = 30 },
+		{ .earfcn = 6400, .phys_cell_id = 4, .rsrp = 20 },
+		{ .earfcn = 6400, .phys_cell_id = 5, .rsrp = 10 },
+	};
+	struct lte_lc_cells_info cell_data = {
+		.current_cell = {
+			.mcc = 244,
+			.mnc = 91,
+			.tac = 0x1234,
+			.id = 0x5678,
+		},
+		.ncells_count = ARRAY_SIZE(neighbors),
+		.neighbor_cells = neighbors,
+	};
+	struct location_data location = {
+		.latitude = 61.0,
+		.longitude = 10.0,
+		.accuracy = 500.0f,
+	};
+
+	zassert_equal(cloud_cache_location_store(&cell_data, NULL, &location), 0);
+
+	/* Only the strongest neighbors are used so the weakest one does not matter */
+	neighbors[4].phys_cell_id = 6;
+	zassert_equal(cloud_cache_location_get(&cell_data, NULL, &location), 0);
+
+	/* Different serving cell and two of the strongest neighbors, 3 of 7 in common */
+	cell_data.current_cell.id = 0x5679;
+	neighbors[0].phys_cell_id = 7;
+	zassert_equal(cloud_cache_location_get(&cell_data, NULL, &location), -ENOENT);
+
+	/* Invalid serving cell does not form a fingerprint */
+	cell_data.current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+	zassert_equal(cloud_cache_location_store(&cell_data, NULL, &location), -EINVAL);
+}
+
+ZTEST(location_cloud_cache, test_persistence)
+{
+	double latitude;
+
+	test_location_store(TEST_WIFI(1, 2, 3, 4), 61.0);
+	test_location_store(TEST_WIFI(5, 6, 7, 8), 62.0);
+	zassert_equal(settings_mock_save_count(), 2);
+
+	/* Simulates a reboot, the entries are loaded from settings */
+	test_cache_ram_reset();
+
+	zassert_equal(test_location_get(TEST_WIFI(5, 6, 7, 8), &latitude), 0);
+	zassert_equal(latitude, 62.0);
+	zassert_equal(test_location_get(TEST_WIFI(1, 2, 3, 4), &latitude), 0);
+	zassert_equal(latitude, 61.0);
+
+	/* LRU stamps continue from the loaded entries */
+	zassert_true(lru_stamp > 2);
+}
+
+ZTEST_SUITE(location_cloud_cache, NULL, NULL, test_before, NULL, NULL);
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+
+#include "settings_mock.h"
+
+#define SETTINGS_MOCK_RECORDS 8
+#define SETTINGS_MOCK_NAME_LEN 32
+#define SETTINGS_MOCK_VAL_LEN 128
+
+struct settings_mock_record {
+	char name[SETTINGS_MOCK_NAME_LEN];
+	uint8_t val[SETTINGS_MOCK_VAL_LEN];
+	size_t val_len;
+};
+
+static struct settings_mock_record records[SETTINGS_MOCK_RECORDS];
+static int save_count;
+
+static ssize_t settings_mock_read_fn(void *back_end, void *data, size_t len)
+{
+	struct settings_mock_record *record = back_end;
+
+	len = MIN(len, record->val_len);
+	memcpy(data, record->val, len);
+
+	return len;
+}
+
+static int settings_mock_load(struct settings_store *cs, const struct settings_load_arg *arg)
+{
+	int err;
+
+	for (int i = 0; i < ARRAY_SIZE(records); i++) {
+		if (records[i].name[0] == '\0') {
+			continue;
+		}
+
+		err = settings_call_set_handler(records[i].name, records[i].val_len,
+						settings_mock_read_fn, &records[i], arg);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static int settings_mock_save(struct settings_store *cs, const char *name, const char *value,
+			      size_t val_len)
+{
+	struct settings_mock_record *record = NULL;
+
+	if (strlen(name) >= SETTINGS_MOCK_NAME_LEN || val_len > SETTINGS_MOCK_VAL_LEN) {
+		return -ENOMEM;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(records); i++) {
+		if (strcmp(records[i].name, name) == 0) {
+			record = &records[i];
+			break;
+		}
+		if (record == NULL && records[i].name[0] == '\0') {
+			record = &records[i];
+		}
+	}
+
+	if (record == NULL) {
+		return -ENOMEM;
+	}
+
+	strcpy(record->name, name);
+	memcpy(record->val, value, val_len);
+	record->val_len = val_len;
+	save_count++;
+
+	return 0;
+}
+
+static struct settings_store_itf settings_mock_itf = {
+	.csi_load = settings_mock_load,
+	.csi_save = settings_mock_save,
+};
+
+static struct settings_store settings_mock_store = {
+	.cs_itf = &settings_mock_itf
+};
+
+void settings_mock_clear(void)
+{
+	memset(records, 0, sizeof(records));
+	save_count = 0;
+}
+
+int settings_mock_save_count(void)
+{
+	return save_count;
+}
+
+/* Called by settings_subsys_init() when the custom backend is selected */
+int settings_backend_init(void)
+{
+	settings_dst_register(&settings_mock_store);
+	settings_src_register(&settings_mock_store);
+
+	return 0;
+}
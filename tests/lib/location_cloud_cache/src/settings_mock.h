@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SETTINGS_MOCK_H_
+#define SETTINGS_MOCK_H_
+
+/** Remove all records from the RAM settings backend. */
+void settings_mock_clear(void);
+
+/** Number of records saved since the last clear. */
+int settings_mock_save_count(void);
+
+#endif /* SETTINGS_MOCK_H_ */
@@ -65,6 +65,34 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			break;
 		}
 
+		case TEST_BATCH:
+		{
+			size_t event_cnt = SAMPLES_IN_AGG_BUF * BATCH_TEST_AGG_EVENTS /
+					   BATCH_TEST_SAMPLES_IN_EVENT;
+			size_t sample_idx = 0;
+
+			for (size_t i = 0; i < event_cnt; i++) {
+				struct sensor_event *se =
+					new_sensor_event(sizeof(struct sensor_value) *
+						BATCH_TEST_SENSOR_SAMPLE_SIZE *
+						BATCH_TEST_SAMPLES_IN_EVENT);
+
+				zassert_not_null(se, "Failed to allocate event");
+				se->descr = BATCH_TEST_AGG_DESCR;
+
+				struct sensor_value *data = sensor_event_get_data_ptr(se);
+
+				for (size_t j = 0; j < BATCH_TEST_SAMPLES_IN_EVENT; j++) {
+					data[j * BATCH_TEST_SENSOR_SAMPLE_SIZE].val1 = sample_idx;
+					sample_idx++;
+				}
+
+				APP_EVENT_SUBMIT(se);
+			}
+
+			break;
+		}
+
 		default:
 			/* Ignore other test cases, check if proper test_id. */
 			zassert_true(st->test_id < TEST_CNT,
@@ -13,6 +13,13 @@
 #define BASIC_TEST_AGG_EVENTS 80
 #define ORDER_TEST_AGG_EVENTS 2
 #define STATUS_TEST_SENSOR_EVENTS 4
+#define BATCH_TEST_SENSOR_SAMPLE_SIZE 1
+#define BATCH_TEST_SAMPLES_IN_EVENT 5
+#define BATCH_TEST_AGG_EVENTS 2
 #define BASIC_TEST_AGG_DESCR "void_basic_test_sensor"
 #define ORDER_TEST_AGG_DESCR "void_order_test_sensor"
 #define STATUS_TEST_AGG_DESCR "void_status_test_sensor"
+#define BATCH_TEST_AGG_DESCR "void_batch_test_sensor"
+#define DIRECT_TEST_AGG_DESCR "void_direct_test_sensor"
+#define DIRECT_TEST_SENSOR_SAMPLE_SIZE 3
+#define DIRECT_TEST_DURATION_MS 1000
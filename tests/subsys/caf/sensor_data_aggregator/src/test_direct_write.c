@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+
+#include <caf/events/sensor_event.h>
+#include <caf/events/sensor_data_aggregator_event.h>
+#include <caf/sensor_data_aggregator.h>
+#include "test_config.h"
+
+#define MODULE test_direct_write
+
+/* Sample rates used by the stress test, in Hz. */
+static const uint32_t sample_rates[] = {1000, 2000, 4000};
+
+static atomic_t received_cnt;
+static atomic_t order_errors;
+static uint32_t expected_idx;
+
+
+static void produce_direct(uint32_t idx, uint32_t *cycles, uint32_t *dropped)
+{
+	struct sensor_value *samples;
+	uint32_t start = k_cycle_get_32();
+	int ret = sensor_data_aggregator_claim(DIRECT_TEST_AGG_DESCR,
+					       DIRECT_TEST_SENSOR_SAMPLE_SIZE, &samples);
+
+	if (ret > 0) {
+		for (size_t i = 0; i < DIRECT_TEST_SENSOR_SAMPLE_SIZE; i++) {
+			samples[i].val1 = idx;
+			samples[i].val2 = i;
+		}
+		sensor_data_aggregator_commit(DIRECT_TEST_AGG_DESCR, 1);
+	} else {
+		(*dropped)++;
+	}
+
+	*cycles += k_cycle_get_32() - start;
+}
+
+static void produce_event(uint32_t idx, uint32_t *cycles, uint32_t *dropped)
+{
+	uint32_t start = k_cycle_get_32();
+	struct sensor_event *se = new_sensor_event(sizeof(struct sensor_value) *
+						   DIRECT_TEST_SENSOR_SAMPLE_SIZE);
+	struct sensor_value *samples = sensor_event_get_data_ptr(se);
+
+	se->descr = DIRECT_TEST_AGG_DESCR;
+	for (size_t i = 0; i < DIRECT_TEST_SENSOR_SAMPLE_SIZE; i++) {
+		samples[i].val1 = idx;
+		samples[i].val2 = i;
+	}
+	APP_EVENT_SUBMIT(se);
+
+	*cycles += k_cycle_get_32() - start;
+	ARG_UNUSED(dropped);
+}
+
+static void run_stress(uint32_t rate, bool direct)
+{
+	uint32_t produced = 0;
+	uint32_t dropped = 0;
+	uint32_t cycles = 0;
+	int64_t start = k_uptime_get();
+	int64_t elapsed;
+
+	atomic_set(&received_cnt, 0);
+	atomic_set(&order_errors, 0);
+	expected_idx = 0;
+
+	/* Samples are produced in bursts on every wake up, similar to a sensor FIFO. */
+	do {
+		elapsed = k_uptime_get() - start;
+
+		uint32_t target = (uint32_t)((rate * MIN(elapsed, DIRECT_TEST_DURATION_MS)) /
+					     MSEC_PER_SEC);
+
+		while (produced < target) {
+			if (direct) {
+				produce_direct(produced, &cycles, &dropped);
+			} else {
+				produce_event(produced, &cycles, &dropped);
+			}
+			produced++;
+		}
+
+		k_sleep(K_MSEC(1));
+	} while (elapsed < DIRECT_TEST_DURATION_MS);
+
+	/* Flush the partially filled buffer. */
+	struct sensor_state_event *sse = new_sensor_state_event();
+
+	sse->descr = DIRECT_TEST_AGG_DESCR;
+	sse->state = SENSOR_STATE_ACTIVE;
+	APP_EVENT_SUBMIT(sse);
+
+	k_sleep(K_MSEC(100));
+
+	TC_PRINT("%s, %u Hz: %u samples, %u dropped, %u cycles per sample\n",
+		 direct ? "direct write" : "sensor_event", rate, produced, dropped,
+		 produced ? (cycles / produced) : 0);
+
+	zassert_equal(dropped, 0, "Samples dropped");
+	zassert_equal(atomic_get(&order_errors), 0, "Incorrect sample order");
+	zassert_equal(atomic_get(&received_cnt), produced, "Samples lost");
+}
+
+ZTEST(caf_sensor_aggregator_tests, test_direct_write_stress)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(sample_rates); i++) {
+		run_stress(sample_rates[i], true);
+	}
+}
+
+ZTEST(caf_sensor_aggregator_tests, test_sensor_event_stress)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(sample_rates); i++) {
+		run_stress(sample_rates[i], false);
+	}
+}
+
+ZTEST(caf_sensor_aggregator_tests, test_claim_errors)
+{
+	struct sensor_value *samples;
+	int ret = sensor_data_aggregator_claim("unknown_sensor", DIRECT_TEST_SENSOR_SAMPLE_SIZE,
+					       &samples);
+
+	zassert_equal(ret, -ENOENT, "Claimed space for unknown sensor");
+
+	ret = sensor_data_aggregator_claim(DIRECT_TEST_AGG_DESCR,
+					   DIRECT_TEST_SENSOR_SAMPLE_SIZE + 1, &samples);
+	zassert_equal(ret, -EBADMSG, "Claimed space with wrong sample size");
+
+	ret = sensor_data_aggregator_claim(DIRECT_TEST_AGG_DESCR,
+					   DIRECT_TEST_SENSOR_SAMPLE_SIZE, &samples);
+	zassert_true(ret > 0, "Cannot claim space");
+
+	ret = sensor_data_aggregator_claim(DIRECT_TEST_AGG_DESCR,
+					   DIRECT_TEST_SENSOR_SAMPLE_SIZE, &samples);
+	zassert_equal(ret, -EBUSY, "Claimed space twice");
+
+	sensor_data_aggregator_commit(DIRECT_TEST_AGG_DESCR, 0);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_sensor_data_aggregator_event(aeh)) {
+		const struct sensor_data_aggregator_event *event =
+			cast_sensor_data_aggregator_event(aeh);
+
+		if (strcmp(event->sensor_descr, DIRECT_TEST_AGG_DESCR)) {
+			return false;
+		}
+
+		/* Buffer is released by the test data receiver. */
+		for (size_t i = 0; i < event->sample_cnt; i++) {
+			const struct sensor_value *sample =
+				&event->samples[i * event->values_in_sample];
+
+			if (sample[0].val1 != expected_idx) {
+				atomic_inc(&order_errors);
+			}
+			expected_idx = sample[0].val1 + 1;
+		}
+
+		atomic_add(&received_cnt, event->sample_cnt);
+
+		return false;
+	}
+
+	zassert_unreachable("Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, sensor_data_aggregator_event);
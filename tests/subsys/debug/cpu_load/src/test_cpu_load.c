@@ -76,4 +76,84 @@ ZTEST(cpu_load, test_cpu_load)
 	zassert_true(load < SMALL_LOAD, "Unexpected load:%d", load);
 }
 
+#ifdef CONFIG_NRF_CPU_LOAD_STATS
+ZTEST(cpu_load, test_cpu_load_thread_stats)
+{
+	struct cpu_load_thread_stats stats;
+	bool found = false;
+
+	cpu_load_stats_reset();
+
+	/* Keep the test thread busy for a few statistics windows. */
+	k_busy_wait(5 * CONFIG_NRF_CPU_LOAD_STATS_WINDOW * USEC_PER_MSEC);
+	k_sleep(K_MSEC(CONFIG_NRF_CPU_LOAD_STATS_WINDOW));
+
+	for (size_t i = 0; cpu_load_thread_stats_get(i, &stats) == 0; i++) {
+		if (stats.thread == k_current_get()) {
+			found = true;
+			break;
+		}
+	}
+
+	zassert_true(found, "Test thread not tracked");
+	zassert_true(stats.load.max > FULL_LOAD / 2, "Unexpected max load:%d",
+		     stats.load.max);
+	zassert_true(stats.load.p50 <= stats.load.p99, "Unexpected p50:%d p99:%d",
+		     stats.load.p50, stats.load.p99);
+	zassert_true(stats.load.p99 <= stats.load.max, "Unexpected p99:%d max:%d",
+		     stats.load.p99, stats.load.max);
+}
+
+#ifdef CONFIG_NRF_CPU_LOAD_STATS_IRQ
+#if defined(CONFIG_SOC_SERIES_NRF54LX)
+#define TEST_IRQ SWI00_IRQn
+#else
+#define TEST_IRQ SWI0_EGU0_IRQn
+#endif
+
+#define TEST_IRQ_COUNT 10
+#define TEST_ISR_DURATION_US 1000
+
+static void test_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	k_busy_wait(TEST_ISR_DURATION_US);
+}
+
+ZTEST(cpu_load, test_cpu_load_irq_stats)
+{
+	struct cpu_load_irq_stats stats;
+	bool found = false;
+
+	IRQ_CONNECT(TEST_IRQ, 1, test_isr, NULL, 0);
+	irq_enable(TEST_IRQ);
+
+	cpu_load_stats_reset();
+
+	for (int i = 0; i < TEST_IRQ_COUNT; i++) {
+		NVIC_SetPendingIRQ(TEST_IRQ);
+		k_sleep(K_MSEC(1));
+	}
+
+	/* Let the statistics windows with the interrupts be processed. */
+	k_sleep(K_MSEC(2 * CONFIG_NRF_CPU_LOAD_STATS_WINDOW));
+	irq_disable(TEST_IRQ);
+
+	for (size_t i = 0; cpu_load_irq_stats_get(i, &stats) == 0; i++) {
+		if (stats.irq == TEST_IRQ) {
+			found = true;
+			break;
+		}
+	}
+
+	zassert_true(found, "Test interrupt not tracked");
+	zassert_equal(stats.count, TEST_IRQ_COUNT, "Unexpected count:%u", stats.count);
+	zassert_true(stats.isr_max_us >= TEST_ISR_DURATION_US / 2,
+		     "Unexpected ISR max:%u", stats.isr_max_us);
+	zassert_true(stats.load.max > 0, "Unexpected max load:%d", stats.load.max);
+}
+#endif /* CONFIG_NRF_CPU_LOAD_STATS_IRQ */
+#endif /* CONFIG_NRF_CPU_LOAD_STATS */
+
 ZTEST_SUITE(cpu_load, NULL, NULL, NULL, NULL, NULL);
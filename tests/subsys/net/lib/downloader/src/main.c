@@ -150,6 +150,20 @@
 "Vary: Accept-Encoding\r\n" \
 "X-Cache: HIT\r\n\r\n"
 
+#define HTTPS_HDR_PIPELINED(range) \
+"HTTP/1.1 206 Partial Content\r\n" \
+"Content-Type: text/html; charset=UTF-8\r\n" \
+"Content-Length: 32\r\n" \
+"Connection: keep-alive\r\n" \
+"Accept-Ranges: bytes\r\n" \
+"Content-Range: bytes " range "/128\r\n\r\n"
+
+#define HTTPS_HDR_PIPELINED_1 HTTPS_HDR_PIPELINED("0-31")
+#define HTTPS_HDR_PIPELINED_2 HTTPS_HDR_PIPELINED("32-63")
+#define HTTPS_HDR_PIPELINED_3 HTTPS_HDR_PIPELINED("64-95")
+#define HTTPS_HDR_PIPELINED_4 HTTPS_HDR_PIPELINED("96-127")
+#define HTTPS_HDR_PIPELINED_SPLIT (sizeof("HTTP/1.1 206 Partial Content\r\n") - 1)
+
 #define HTTP_HDR_REDIRECT "HTTP/1.1 308 Permanent Redirect\r\n" \
 "Date: Wed, 29 Jan 2025 11:16:09 GMT\r\n" \
 "Content-Type: text/html\r\n" \
@@ -180,6 +194,22 @@ struct downloader_cfg dl_cfg_small_buffer = {
 	.buf_size = 32,
 };
 
+static int dl_callback_record(const struct downloader_evt *event);
+
+struct downloader_cfg dl_cfg_record = {
+	.callback = dl_callback_record,
+	.buf = dl_buf,
+	.buf_size = sizeof(dl_buf),
+};
+
+static int dl_callback_reassemble(const struct downloader_evt *event);
+
+struct downloader_cfg dl_cfg_reassemble = {
+	.callback = dl_callback_reassemble,
+	.buf = dl_buf,
+	.buf_size = sizeof(dl_buf),
+};
+
 struct downloader_cfg dl_cfg_cb_abort = {
 	.callback = dl_callback_abort,
 	.buf = dl_buf,
@@ -216,6 +246,11 @@ struct downloader_transport_http_cfg dl_http_cfg = {
 	.sock_recv_timeo_ms = 60000,
 };
 
+struct downloader_transport_http_cfg dl_http_cfg_pipelined = {
+	.sock_recv_timeo_ms = 60000,
+	.pipeline_depth = 4,
+};
+
 DEFINE_FFF_GLOBALS;
 
 FAKE_VALUE_FUNC(int, z_impl_zsock_setsockopt, int, int, int, const void *, net_socklen_t);
@@ -860,6 +895,45 @@ static ssize_t z_impl_zsock_recvfrom_https_partial_content(
 	return 0;
 }
 
+static size_t recvfrom_put(void *buf, size_t off, const char *hdr, uint8_t fill)
+{
+	memcpy((char *)buf + off, hdr, strlen(hdr));
+	off += strlen(hdr);
+	memset((char *)buf + off, fill, 32);
+
+	return off + 32;
+}
+
+static ssize_t z_impl_zsock_recvfrom_https_pipelined(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	size_t len = 0;
+
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(sizeof(dl_buf) >= max_len);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		/* Response to the first request, which provides the file size. */
+		return recvfrom_put(buf, 0, HTTPS_HDR_PIPELINED_1, 1);
+	case 2:
+		/* The remaining requests are pipelined, their responses arrive together. */
+		len = recvfrom_put(buf, len, HTTPS_HDR_PIPELINED_2, 2);
+		len = recvfrom_put(buf, len, HTTPS_HDR_PIPELINED_3, 3);
+		/* Split the last header after the status line to verify streaming parsing. */
+		memcpy((char *)buf + len, HTTPS_HDR_PIPELINED_4, HTTPS_HDR_PIPELINED_SPLIT);
+		return len + HTTPS_HDR_PIPELINED_SPLIT;
+	case 3:
+		len = strlen(HTTPS_HDR_PIPELINED_4) - HTTPS_HDR_PIPELINED_SPLIT;
+		memcpy(buf, HTTPS_HDR_PIPELINED_4 + HTTPS_HDR_PIPELINED_SPLIT, len);
+		memset((char *)buf + len, 4, 32);
+		return len + 32;
+	}
+
+	return 0;
+}
+
 static ssize_t z_impl_zsock_recvfrom_https_partial_content_partial_2nd_header(
 	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
 	net_socklen_t *addrlen)
@@ -1250,6 +1324,38 @@ static int dl_callback(const struct downloader_evt *event)
 	return 0;
 }
 
+#define TEST_WINDOW_BLOCKS 4
+#define TEST_WINDOW_BLOCK_BYTES 64
+
+/* First byte of each received fragment, recorded in the downloader thread. */
+static uint8_t fragment_first_byte[TEST_WINDOW_BLOCKS];
+static size_t fragment_cnt;
+
+static int dl_callback_record(const struct downloader_evt *event)
+{
+	if (event->id == DOWNLOADER_EVT_FRAGMENT) {
+		TEST_ASSERT(fragment_cnt < ARRAY_SIZE(fragment_first_byte));
+		fragment_first_byte[fragment_cnt++] = ((const uint8_t *)event->fragment.buf)[0];
+	}
+
+	return dl_callback(event);
+}
+
+/* Downloaded file, reassembled from the fragments in the downloader thread. */
+static uint8_t reassembled[256];
+static size_t reassembled_len;
+
+static int dl_callback_reassemble(const struct downloader_evt *event)
+{
+	if (event->id == DOWNLOADER_EVT_FRAGMENT) {
+		TEST_ASSERT(reassembled_len + event->fragment.len <= sizeof(reassembled));
+		memcpy(&reassembled[reassembled_len], event->fragment.buf, event->fragment.len);
+		reassembled_len += event->fragment.len;
+	}
+
+	return dl_callback(event);
+}
+
 static int dl_callback_abort(const struct downloader_evt *event)
 {
 	TEST_ASSERT(event != NULL);
@@ -1483,6 +1589,54 @@ void test_downloader_get_https_partial_content_partial_2nd_header(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+void test_downloader_get_https_pipelined(void)
+{
+	int err;
+	struct downloader_evt evt;
+	size_t progress = 0;
+
+	reassembled_len = 0;
+
+	err = downloader_init(&dl, &dl_cfg_reassemble);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_transport_http_set_config(&dl, &dl_http_cfg_pipelined);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_https_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_https_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_https_pipelined;
+
+	err = downloader_get(&dl, &dl_host_conf_w_sec_tags_range_override_32, HTTPS_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	while (progress < 128) {
+		evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+		/* Each fragment must contain only the data of its own range. */
+		TEST_ASSERT_EQUAL(32, evt.fragment.len);
+		progress += evt.fragment.len;
+	}
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	/* The ranges are reassembled in order, without any of the response headers. */
+	TEST_ASSERT_EQUAL(128, reassembled_len);
+	for (size_t i = 0; i < reassembled_len; i++) {
+		TEST_ASSERT_EQUAL(1 + i / 32, reassembled[i]);
+	}
+
+	/* Four range requests, but only three receive round trips. */
+	TEST_ASSERT_EQUAL(4, z_impl_zsock_sendto_fake.call_count);
+	TEST_ASSERT_EQUAL(3, z_impl_zsock_recvfrom_fake.call_count);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_https_unlimited_redirect(void)
 {
 	int err;
@@ -2067,6 +2221,137 @@ void test_downloader_get_coap_retransmission_recovery(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+/* Windowed transfer: request IDs per block and the order in which blocks are answered. */
+static uint16_t window_init_id;
+static uint16_t window_req_id[TEST_WINDOW_BLOCKS];
+static const uint8_t window_resp_order[TEST_WINDOW_BLOCKS] = {0, 2, 1, 3};
+static uint8_t window_resp_block;
+static int window_max_in_flight;
+
+static int coap_packet_init_window(struct coap_packet *cpkt, uint8_t *data, uint16_t max_len,
+				   uint8_t ver, uint8_t type, uint8_t token_len,
+				   const uint8_t *token, uint8_t code, uint16_t id)
+{
+	window_init_id = id;
+
+	return 0;
+}
+
+static int coap_append_block2_option_window(struct coap_packet *cpkt,
+					    struct coap_block_context *ctx)
+{
+	TEST_ASSERT_EQUAL(COAP_BLOCK_64, ctx->block_size);
+	TEST_ASSERT(ctx->current / TEST_WINDOW_BLOCK_BYTES < TEST_WINDOW_BLOCKS);
+
+	window_req_id[ctx->current / TEST_WINDOW_BLOCK_BYTES] = window_init_id;
+
+	return 0;
+}
+
+static ssize_t z_impl_zsock_recvfrom_coap_window(int sock, void *buf, size_t max_len, int flags,
+						 struct net_sockaddr *src_addr,
+						 net_socklen_t *addrlen)
+{
+	TEST_ASSERT(z_impl_zsock_recvfrom_fake.call_count <= TEST_WINDOW_BLOCKS);
+
+	window_resp_block = window_resp_order[z_impl_zsock_recvfrom_fake.call_count - 1];
+	window_max_in_flight = MAX(window_max_in_flight,
+				   (int)(z_impl_zsock_sendto_fake.call_count -
+					 (z_impl_zsock_recvfrom_fake.call_count - 1)));
+
+	memset(buf, 23, 32);
+	return 32;
+}
+
+static uint16_t coap_header_get_id_window(const struct coap_packet *cpkt)
+{
+	return window_req_id[window_resp_block];
+}
+
+static int coap_get_option_int_window(const struct coap_packet *cpkt, uint16_t code)
+{
+	bool more = (window_resp_block < (TEST_WINDOW_BLOCKS - 1));
+
+	switch (code) {
+	case COAP_OPTION_BLOCK2:
+		return (window_resp_block << 4) | (more << 3) | COAP_BLOCK_64;
+	case COAP_OPTION_SIZE2:
+		return TEST_WINDOW_BLOCKS * TEST_WINDOW_BLOCK_BYTES;
+	}
+
+	return 0;
+}
+
+static const uint8_t *coap_packet_get_payload_window(const struct coap_packet *cpkt,
+						     uint16_t *len)
+{
+	static uint8_t payload[TEST_WINDOW_BLOCK_BYTES];
+
+	memset(payload, window_resp_block, sizeof(payload));
+	*len = sizeof(payload);
+
+	return payload;
+}
+
+void test_downloader_get_coap_window(void)
+{
+	int err;
+	struct downloader_evt evt;
+	struct downloader_transport_coap_cfg coap_cfg = {
+		.block_size = COAP_BLOCK_64,
+		.max_retransmission = 4,
+		.window_size = TEST_WINDOW_BLOCKS,
+	};
+
+	fragment_cnt = 0;
+	window_max_in_flight = 0;
+
+	err = downloader_init(&dl, &dl_cfg_record);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_transport_coap_set_config(&dl, &coap_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_coap_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_coap_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_coap_window;
+
+	coap_get_transmission_parameters_fake.custom_fake = coap_get_transmission_parameters_ok;
+	coap_packet_init_fake.custom_fake = coap_packet_init_window;
+	coap_append_block2_option_fake.custom_fake = coap_append_block2_option_window;
+	coap_get_option_int_fake.custom_fake = coap_get_option_int_window;
+	coap_header_get_id_fake.custom_fake = coap_header_get_id_window;
+	coap_header_get_type_fake.custom_fake = coap_header_get_type_ack;
+	coap_header_get_code_fake.custom_fake = coap_header_get_code_ok;
+	coap_packet_get_payload_fake.custom_fake = coap_packet_get_payload_window;
+
+	err = downloader_get(&dl, &dl_host_cfg, COAP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(DOWNLOADER_EVT_DONE, evt.id);
+
+	/* Blocks answered out of order are forwarded in order. */
+	TEST_ASSERT_EQUAL(TEST_WINDOW_BLOCKS, fragment_cnt);
+	for (size_t i = 0; i < TEST_WINDOW_BLOCKS; i++) {
+		TEST_ASSERT_EQUAL(i, fragment_first_byte[i]);
+	}
+
+	/* Every block is requested once and several requests are in flight
+	 * after the first response provides the total size.
+	 */
+	TEST_ASSERT_EQUAL(TEST_WINDOW_BLOCKS, z_impl_zsock_sendto_fake.call_count);
+	TEST_ASSERT_EQUAL(TEST_WINDOW_BLOCKS, z_impl_zsock_recvfrom_fake.call_count);
+	TEST_ASSERT(window_max_in_flight >= 2);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_get_einval(void)
 {
 	int err;
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/coap_client.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_codec.h>
+#include <nrf_cloud_codec_internal.h>
+#include <nrf_cloud_dns.h>
+#include <nrfc_dtls.h>
+
+DEFINE_FFF_GLOBALS;
+
+/* Fake functions declaration */
+FAKE_VALUE_FUNC(int, coap_client_init, struct coap_client *, const char *);
+FAKE_VALUE_FUNC(int, coap_client_req, struct coap_client *, int, const struct net_sockaddr *,
+		struct coap_client_request *, struct coap_transmission_parameters *);
+FAKE_VOID_FUNC(coap_client_cancel_requests, struct coap_client *);
+FAKE_VOID_FUNC(coap_client_cancel_request, struct coap_client *, struct coap_client_request *);
+FAKE_VALUE_FUNC(int, z_impl_zsock_socket, int, int, int);
+FAKE_VALUE_FUNC(int, z_impl_zsock_connect, int, const struct net_sockaddr *, net_socklen_t);
+FAKE_VALUE_FUNC(int, z_impl_zsock_close, int);
+FAKE_VALUE_FUNC(int, nrf_cloud_connect_host, const char *, uint16_t, struct zsock_addrinfo *,
+		nrf_cloud_connect_host_cb);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_shadow_state_update, const char *);
+FAKE_VALUE_FUNC(int, nrf_cloud_codec_init, struct nrf_cloud_os_mem_hooks *);
+FAKE_VOID_FUNC(nrf_cloud_device_control_get, struct nrf_cloud_ctrl_data *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_shadow_control_response_encode,
+		const struct nrf_cloud_ctrl_data *const, bool, struct nrf_cloud_data *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_enabled_info_sections_json_encode, cJSON *const,
+		const char *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_modem_info_json_encode, const struct nrf_cloud_modem_info *const,
+		cJSON *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_jwt_generate, uint32_t, char *const, size_t);
+FAKE_VALUE_FUNC(int, nrf_cloud_print_details);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_init, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_free, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_cloud_encode, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_cloud_encoded_free, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(void *, nrf_cloud_malloc, size_t);
+FAKE_VOID_FUNC(nrf_cloud_free, void *);
+FAKE_VALUE_FUNC(int, nrfc_dtls_setup, int);
+FAKE_VALUE_FUNC(bool, nrfc_dtls_cid_is_active, int);
+FAKE_VALUE_FUNC(int, nrfc_dtls_session_save, int);
+FAKE_VALUE_FUNC(int, nrfc_dtls_session_load, int);
+FAKE_VALUE_FUNC(bool, nrfc_keepopen_is_supported);
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Unit tests for nrf_cloud_coap_request_async().
+ *
+ * coap_client_req() is faked to capture the requests instead of sending them,
+ * and the tests complete the requests by calling the captured response callback
+ * the way the CoAP client thread would.
+ */
+
+#include <limits.h>
+#include "fakes.h"
+#include "nrf_cloud_coap_transport.c"
+
+#define TEST_RESOURCE "msg/d2c"
+#define TEST_PAYLOAD "{\"appId\":\"TEMP\",\"data\":\"24.5\"}"
+#define TEST_PAYLOAD_LEN (sizeof(TEST_PAYLOAD) - 1)
+#define MAX_CAPTURED 8
+
+static const uint8_t test_payload[] = TEST_PAYLOAD;
+
+static struct coap_client_request captured[MAX_CAPTURED];
+static bool answered[MAX_CAPTURED];
+static size_t captured_count;
+
+static int done_count;
+static int done_result;
+static void *done_user;
+
+static int fake_coap_client_req__capture(struct coap_client *client, int sock,
+					 const struct net_sockaddr *addr,
+					 struct coap_client_request *req,
+					 struct coap_transmission_parameters *params)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(sock);
+	ARG_UNUSED(addr);
+	ARG_UNUSED(params);
+
+	zassert_true(captured_count < MAX_CAPTURED, "Too many requests");
+	captured[captured_count] = *req;
+	answered[captured_count] = false;
+	captured_count++;
+
+	return 0;
+}
+
+static void done_cb(int result, void *user)
+{
+	done_count++;
+	done_result = result;
+	done_user = user;
+}
+
+static void request_respond(size_t idx, int16_t result_code, bool last_block)
+{
+	struct coap_client_response_data data = {
+		.result_code = result_code,
+		.last_block = last_block,
+	};
+
+	zassert_true(idx < captured_count, "No request %zu", idx);
+	answered[idx] = true;
+	captured[idx].cb(&data, captured[idx].user_data);
+}
+
+static int request_send(const uint8_t *buf, size_t len, void *user)
+{
+	return nrf_cloud_coap_request_async(COAP_METHOD_POST, TEST_RESOURCE, NULL, buf, len,
+					    COAP_CONTENT_FORMAT_APP_JSON,
+					    COAP_CONTENT_FORMAT_APP_JSON, false, NULL, done_cb,
+					    user);
+}
+
+static void coap_transport_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	RESET_FAKE(coap_client_req);
+	FFF_RESET_HISTORY();
+	coap_client_req_fake.custom_fake = fake_coap_client_req__capture;
+
+	captured_count = 0;
+	done_count = 0;
+	done_result = INT_MIN;
+	done_user = NULL;
+
+	internal_cc.authenticated = true;
+	internal_cc.paused = false;
+	internal_cc.sock = 1;
+}
+
+static void coap_transport_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Complete the requests left in flight to return their transfers to the pools */
+	for (size_t i = 0; i < captured_count; i++) {
+		if (!answered[i]) {
+			request_respond(i, COAP_RESPONSE_CODE_CHANGED, true);
+		}
+	}
+}
+
+ZTEST_SUITE(nrf_cloud_coap_transport, NULL, NULL, coap_transport_before,
+	    coap_transport_after, NULL);
+
+ZTEST(nrf_cloud_coap_transport, test_request_async_payload_copied)
+{
+	uint8_t buf[] = TEST_PAYLOAD;
+	size_t len = TEST_PAYLOAD_LEN;
+	int user;
+	int err;
+
+	err = request_send(buf, len, &user);
+	zassert_ok(err, "Unexpected error: %d", err);
+	zassert_equal(coap_client_req_fake.call_count, 1);
+
+	/* The caller may reuse its buffer as soon as the request has been sent */
+	memset(buf, 0, sizeof(buf));
+
+	zassert_equal(captured[0].method, COAP_METHOD_POST);
+	zassert_true(captured[0].confirmable);
+	zassert_str_equal(captured[0].path, TEST_RESOURCE);
+	zassert_equal(captured[0].fmt, COAP_CONTENT_FORMAT_APP_JSON);
+	zassert_equal(captured[0].len, len);
+	zassert_not_equal(captured[0].payload, buf, "Caller's buffer passed to coap_client");
+	zassert_mem_equal(captured[0].payload, test_payload, len);
+	zassert_equal(done_count, 0);
+
+	request_respond(0, COAP_RESPONSE_CODE_CHANGED, true);
+	zassert_equal(done_count, 1);
+	zassert_ok(done_result);
+	zassert_equal_ptr(done_user, &user);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_request_async_query)
+{
+	int err;
+
+	err = nrf_cloud_coap_request_async(COAP_METHOD_GET, "loc/ground-fix", "doReply=false",
+					   NULL, 0, COAP_CONTENT_FORMAT_APP_CBOR,
+					   COAP_CONTENT_FORMAT_APP_CBOR, true, NULL, done_cb, NULL);
+	zassert_ok(err, "Unexpected error: %d", err);
+
+	zassert_equal(captured[0].method, COAP_METHOD_GET);
+	zassert_str_equal(captured[0].path, "loc/ground-fix?doReply=false");
+	zassert_equal(captured[0].len, 0);
+	zassert_equal(captured[0].num_options, 1);
+	zassert_equal(captured[0].options[0].code, COAP_OPTION_ACCEPT);
+	zassert_equal(captured[0].options[0].value[0], COAP_CONTENT_FORMAT_APP_CBOR);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_request_async_rejected)
+{
+	zassert_ok(request_send(test_payload, TEST_PAYLOAD_LEN, NULL));
+
+	/* Rejected by the cloud: positive CoAP result code */
+	request_respond(0, COAP_RESPONSE_CODE_NOT_FOUND, true);
+	zassert_equal(done_count, 1);
+	zassert_equal(done_result, COAP_RESPONSE_CODE_NOT_FOUND);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_request_async_failed)
+{
+	zassert_ok(request_send(test_payload, TEST_PAYLOAD_LEN, NULL));
+
+	/* Device-side failure: the transfer ends even though it is not the last block */
+	request_respond(0, -ETIMEDOUT, false);
+	zassert_equal(done_count, 1);
+	zassert_equal(done_result, -ETIMEDOUT);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_request_async_invalid)
+{
+	zassert_equal(nrf_cloud_coap_request_async(COAP_METHOD_POST, TEST_RESOURCE, NULL,
+						   test_payload, TEST_PAYLOAD_LEN,
+						   COAP_CONTENT_FORMAT_APP_JSON,
+						   COAP_CONTENT_FORMAT_APP_JSON, false, NULL, NULL,
+						   NULL), -EINVAL);
+	zassert_equal(request_send(NULL, CONFIG_NRF_CLOUD_COAP_ASYNC_PAYLOAD_SIZE + 1, NULL),
+		      -EMSGSIZE);
+
+	internal_cc.authenticated = false;
+	zassert_equal(request_send(test_payload, TEST_PAYLOAD_LEN, NULL), -EACCES);
+
+	zassert_equal(coap_client_req_fake.call_count, 0);
+	zassert_equal(done_count, 0);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_request_async_payload_pool)
+{
+	int err;
+
+	/* One payload buffer per coap_client request slot */
+	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS; i++) {
+		err = request_send(test_payload, TEST_PAYLOAD_LEN, NULL);
+		zassert_ok(err, "Request %d: unexpected error: %d", i, err);
+	}
+
+	err = request_send(test_payload, TEST_PAYLOAD_LEN, NULL);
+	zassert_equal(err, -EAGAIN, "Unexpected error: %d", err);
+	zassert_equal(coap_client_req_fake.call_count, CONFIG_COAP_CLIENT_MAX_REQUESTS);
+
+	/* Requests without a payload only need a transfer context */
+	err = request_send(NULL, 0, NULL);
+	zassert_ok(err, "Unexpected error: %d", err);
+
+	/* Completing a request frees its payload buffer */
+	request_respond(0, COAP_RESPONSE_CODE_CHANGED, true);
+	err = request_send(test_payload, TEST_PAYLOAD_LEN, NULL);
+	zassert_ok(err, "Unexpected error: %d", err);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_request_async_client_busy)
+{
+	int err;
+
+	coap_client_req_fake.custom_fake = NULL;
+	coap_client_req_fake.return_val = -EAGAIN;
+
+	/* More attempts than there are transfer contexts and payload buffers, all of them
+	 * must be released when coap_client has no free request slot.
+	 */
+	for (int i = 0; i < 2 * MAX_XFERS; i++) {
+		err = request_send(test_payload, TEST_PAYLOAD_LEN, NULL);
+		zassert_equal(err, -EAGAIN, "Attempt %d: unexpected error: %d", i, err);
+	}
+	zassert_equal(coap_client_req_fake.call_count, 2 * MAX_XFERS);
+	zassert_equal(done_count, 0);
+
+	coap_client_req_fake.custom_fake = fake_coap_client_req__capture;
+	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS; i++) {
+		err = request_send(test_payload, TEST_PAYLOAD_LEN, NULL);
+		zassert_ok(err, "Request %d: unexpected error: %d", i, err);
+	}
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Fakes required to link nrf_cloud_codec_internal.c in the test environment.
+ *
+ * The memory wrappers from nrf_cloud_mem.c are replaced by wrappers around the
+ * standard C library allocator that count the allocations, so that the tests
+ * can compare the heap usage of the location request encoders.
+ */
+
+#include <stdlib.h>
+#include <nrf_cloud_mem.h>
+#include <net/nrf_cloud_log.h>
+
+#include "fakes.h"
+
+size_t fake_alloc_count;
+size_t fake_alloc_bytes;
+
+void *nrf_cloud_calloc(size_t count, size_t size)
+{
+	fake_alloc_count++;
+	fake_alloc_bytes += count * size;
+
+	return calloc(count, size);
+}
+
+void *nrf_cloud_malloc(size_t size)
+{
+	fake_alloc_count++;
+	fake_alloc_bytes += size;
+
+	return malloc(size);
+}
+
+void nrf_cloud_free(void *ptr)
+{
+	free(ptr);
+}
+
+/* Log control is only used by the shadow codec, not by location requests */
+
+void nrf_cloud_log_control_set(int log_level)
+{
+	(void)log_level;
+}
+
+int nrf_cloud_log_control_get(void)
+{
+	return 0;
+}
@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FAKES_H__
+#define FAKES_H__
+
+#include <stddef.h>
+
+/* Number of allocations made through the nrf_cloud memory wrappers */
+extern size_t fake_alloc_count;
+/* Number of bytes allocated through the nrf_cloud memory wrappers */
+extern size_t fake_alloc_bytes;
+
+#endif /* FAKES_H__ */
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Unit tests for nrf_cloud_location_req_json_buf_encode().
+ *
+ * The buffer encoder must produce exactly the same location request as the
+ * cJSON encoder, nrf_cloud_obj_location_request_create_timestamped() followed
+ * by nrf_cloud_obj_cloud_encode(). Every test encodes the same input with both
+ * encoders and compares the output. The heap usage and the encoding time of
+ * both encoders are printed for comparison.
+ */
+
+#include <zephyr/ztest.h>
+#include <net/nrf_cloud_codec.h>
+#include <net/nrf_cloud_location.h>
+#include <nrf_cloud_codec_internal.h>
+#include <nrf_cloud_mem.h>
+#include <string.h>
+
+#include "fakes.h"
+
+#define TEST_TIMESTAMP 1767225600123LL
+
+static char req_buf[1024];
+
+static struct lte_lc_ncell test_ncells[] = {
+	{
+		.earfcn = 6300,
+		.time_diff = 24,
+		.phys_cell_id = 194,
+		.rsrp = 40,
+		.rsrq = 21,
+	},
+	{
+		.earfcn = 6300,
+		.time_diff = LTE_LC_CELL_TIME_DIFF_INVALID,
+		.phys_cell_id = 23,
+		.rsrp = 35,
+		.rsrq = LTE_LC_CELL_RSRQ_INVALID,
+	},
+};
+
+static struct lte_lc_cell test_gci_cells[] = {
+	{
+		.mcc = 244,
+		.mnc = 91,
+		.id = 0x1234570,
+		.tac = 0x0401,
+		.earfcn = 1650,
+		.timing_advance = LTE_LC_CELL_TIMING_ADVANCE_INVALID,
+		.phys_cell_id = 300,
+		.rsrp = 30,
+		.rsrq = 10,
+	},
+};
+
+static struct lte_lc_cells_info test_cells = {
+	.current_cell = {
+		.mcc = 244,
+		.mnc = 91,
+		.id = 0x1234567,
+		.tac = 0x0400,
+		.earfcn = 6300,
+		.timing_advance = 80,
+		.phys_cell_id = 448,
+		.rsrp = 50,
+		.rsrq = 15,
+	},
+	.ncells_count = ARRAY_SIZE(test_ncells),
+	.neighbor_cells = test_ncells,
+	.gci_cells_count = ARRAY_SIZE(test_gci_cells),
+	.gci_cells = test_gci_cells,
+};
+
+static struct lte_lc_cells_info test_cells_no_gci = {
+	.current_cell = {
+		.id = LTE_LC_CELL_EUTRAN_ID_INVALID,
+	},
+};
+
+static struct wifi_scan_result test_aps[] = {
+	{
+		.ssid = "ap-1",
+		.ssid_length = 4,
+		.channel = 1,
+		.rssi = -45,
+		.mac = {0x10, 0x22, 0x33, 0x44, 0x55, 0x01},
+		.mac_length = 6,
+	},
+	{
+		.ssid = "ap-2",
+		.ssid_length = 4,
+		.channel = 6,
+		.rssi = -62,
+		.mac = {0x10, 0x22, 0x33, 0x44, 0x55, 0x02},
+		.mac_length = 6,
+	},
+	{
+		/* Local MAC address, not included in the request */
+		.ssid = "local",
+		.ssid_length = 5,
+		.channel = 11,
+		.rssi = -50,
+		.mac = {0x12, 0x22, 0x33, 0x44, 0x55, 0x03},
+		.mac_length = 6,
+	},
+	{
+		.ssid_length = 0,
+		.channel = 36,
+		.rssi = NRF_CLOUD_LOCATION_WIFI_OMIT_RSSI,
+		.mac = {0x10, 0x22, 0x33, 0x44, 0x55, 0x04},
+		.mac_length = 6,
+	},
+};
+
+static struct wifi_scan_info test_wifi = {
+	.ap_info = test_aps,
+	.cnt = ARRAY_SIZE(test_aps),
+};
+
+static struct nrf_cloud_location_config test_config = {
+	.do_reply = false,
+	.hi_conf = true,
+	.fallback = NRF_CLOUD_LOCATION_FALLBACK_DEFAULT,
+};
+
+static size_t encoders_compare(const struct lte_lc_cells_info *cells,
+			       const struct wifi_scan_info *wifi,
+			       const struct nrf_cloud_location_config *config,
+			       int64_t timestamp)
+{
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+	size_t cjson_alloc_count;
+	size_t cjson_alloc_bytes;
+	uint32_t cjson_us;
+	uint32_t buf_us;
+	uint32_t start;
+	size_t len = sizeof(req_buf);
+	int err;
+
+	fake_alloc_count = 0;
+	fake_alloc_bytes = 0;
+	start = k_cycle_get_32();
+
+	err = nrf_cloud_obj_location_request_create_timestamped(&obj, cells, wifi, config,
+								timestamp);
+	zassert_ok(err, "cJSON encoder failed: %d", err);
+	err = nrf_cloud_obj_cloud_encode(&obj);
+	zassert_ok(err, "cJSON print failed: %d", err);
+
+	cjson_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	cjson_alloc_count = fake_alloc_count;
+	cjson_alloc_bytes = fake_alloc_bytes;
+
+	fake_alloc_count = 0;
+	fake_alloc_bytes = 0;
+	start = k_cycle_get_32();
+
+	err = nrf_cloud_location_req_json_buf_encode(cells, wifi, config, timestamp,
+						     req_buf, &len);
+
+	buf_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	zassert_ok(err, "Buffer encoder failed: %d", err);
+	zassert_equal(fake_alloc_count, 0, "Buffer encoder used the heap");
+	zassert_equal(len, strlen(req_buf), "Unexpected length: %zu", len);
+	zassert_equal(len, obj.encoded_data.len, "Length %zu, expected %zu", len,
+		      obj.encoded_data.len);
+	zassert_mem_equal(req_buf, obj.encoded_data.ptr, len,
+			  "Output differs:\n%s\nexpected:\n%s", req_buf,
+			  (const char *)obj.encoded_data.ptr);
+
+	TC_PRINT("%zu bytes, cJSON: %u us, %zu allocations, %zu heap bytes; buffer: %u us\n",
+		 len, cjson_us, cjson_alloc_count, cjson_alloc_bytes, buf_us);
+
+	(void)nrf_cloud_obj_cloud_encoded_free(&obj);
+	(void)nrf_cloud_obj_free(&obj);
+
+	return len;
+}
+
+static void *location_setup(void)
+{
+	struct nrf_cloud_os_mem_hooks hooks = {
+		.malloc_fn = nrf_cloud_malloc,
+		.calloc_fn = nrf_cloud_calloc,
+		.free_fn = nrf_cloud_free,
+	};
+
+	/* Route the cJSON allocations through the counting allocators */
+	zassert_ok(nrf_cloud_codec_init(&hooks));
+
+	return NULL;
+}
+
+ZTEST_SUITE(nrf_cloud_codec_location, NULL, location_setup, NULL, NULL, NULL);
+
+ZTEST(nrf_cloud_codec_location, test_cells_only)
+{
+	encoders_compare(&test_cells, NULL, NULL, 0);
+}
+
+ZTEST(nrf_cloud_codec_location, test_wifi_only)
+{
+	encoders_compare(NULL, &test_wifi, NULL, 0);
+}
+
+ZTEST(nrf_cloud_codec_location, test_cells_and_wifi)
+{
+	encoders_compare(&test_cells, &test_wifi, &test_config, TEST_TIMESTAMP);
+}
+
+ZTEST(nrf_cloud_codec_location, test_no_gci_cells_with_wifi)
+{
+	/* Cellular data is excluded from the request */
+	encoders_compare(&test_cells_no_gci, &test_wifi, NULL, 0);
+}
+
+ZTEST(nrf_cloud_codec_location, test_too_few_aps_with_cells)
+{
+	struct wifi_scan_info wifi = {
+		.ap_info = test_aps,
+		.cnt = 1,
+	};
+
+	/* Wi-Fi data is excluded from the request */
+	encoders_compare(&test_cells, &wifi, NULL, 0);
+}
+
+ZTEST(nrf_cloud_codec_location, test_buffer_too_small)
+{
+	size_t full_len = encoders_compare(&test_cells, &test_wifi, &test_config,
+					   TEST_TIMESTAMP);
+	size_t len;
+	int err;
+
+	/* Room is needed for the NUL terminator too */
+	for (size_t size = 1; size <= full_len; size++) {
+		len = size;
+		memset(req_buf, 'x', sizeof(req_buf));
+
+		err = nrf_cloud_location_req_json_buf_encode(&test_cells, &test_wifi,
+							     &test_config, TEST_TIMESTAMP,
+							     req_buf, &len);
+		zassert_equal(err, -ENOMEM, "Size %zu: unexpected error: %d", size, err);
+		zassert_equal(len, 0, "Size %zu: unexpected length: %zu", size, len);
+		zassert_equal(req_buf[0], '\0', "Size %zu: buffer not cleared", size);
+		zassert_equal(req_buf[size], 'x', "Size %zu: buffer overrun", size);
+	}
+
+	len = full_len + 1;
+	err = nrf_cloud_location_req_json_buf_encode(&test_cells, &test_wifi, &test_config,
+						     TEST_TIMESTAMP, req_buf, &len);
+	zassert_ok(err, "Unexpected error: %d", err);
+	zassert_equal(len, full_len, "Unexpected length: %zu", len);
+}
+
+ZTEST(nrf_cloud_codec_location, test_invalid_params)
+{
+	struct wifi_scan_info wifi = {
+		.ap_info = test_aps,
+		.cnt = NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN - 1,
+	};
+	size_t len = sizeof(req_buf);
+
+	zassert_equal(nrf_cloud_location_req_json_buf_encode(NULL, NULL, NULL, 0, req_buf,
+							     &len), -EINVAL);
+	zassert_equal(nrf_cloud_location_req_json_buf_encode(&test_cells, NULL, NULL, 0, NULL,
+							     &len), -EINVAL);
+	zassert_equal(nrf_cloud_location_req_json_buf_encode(NULL, &wifi, NULL, 0, req_buf,
+							     &len), -EDOM);
+}